@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "IPlayerSystem.hpp"
 
 namespace SPMod
@@ -58,6 +60,9 @@ namespace SPMod
         virtual NavigationType getNavType() const = 0;
 
         virtual void setCallback(MenuItemCallback func) = 0;
+
+        // false if the callback returns the same status for every player
+        virtual void setPlayerDependent(bool dependent) = 0;
     
     protected:
         virtual ~IMenuItem() {}
@@ -108,6 +113,13 @@ namespace SPMod
 
         virtual std::size_t getItems() const = 0;
 
+        // players - bit n set for player with index n, item style menu has to be global
+        virtual void displayToSet(std::uint64_t players,
+                                  int page,
+                                  int time) = 0;
+        virtual void displayToAll(int page,
+                                  int time) = 0;
+
     protected:
         virtual ~IMenu() {}
     };
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2018 SPMod Development Team
+ *
+ *  This file is part of SPMod.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SPMod
+{
+    /**
+     * @brief Types of values written to a message.
+     */
+    enum class MsgParamType : uint8_t
+    {
+        Byte = 0,
+        Char,
+        Short,
+        Long,
+        Angle,
+        Coord,
+        String,
+        Entity
+    };
+
+    /**
+     * @brief Single value written to a message.
+     *
+     * @note Angles and coordinates are read from fValue, strings from sValue
+     *       and the rest from iValue.
+     */
+    struct MsgParam
+    {
+        MsgParamType type;
+        int iValue;
+        float fValue;
+        const char *sValue;
+    };
+
+    class IMessageMngr
+    {
+    public:
+        /**
+         * @brief Sends a message to every player of a set.
+         *
+         * @note Values are written as they are to every player,
+         *       players who are not in game are skipped.
+         *
+         * @param players   Bit n stands for player with index n.
+         * @param reliable  True to send through reliable channel (MSG_ONE),
+         *                  false for MSG_ONE_UNRELIABLE.
+         * @param msgid     Message index.
+         * @param params    Values of the message.
+         * @param paramsNum Number of values.
+         *
+         * @return          Number of players message has been sent to.
+         */
+        virtual unsigned int sendToSet(uint64_t players,
+                                       bool reliable,
+                                       int msgid,
+                                       const MsgParam *params,
+                                       std::size_t paramsNum) = 0;
+
+        /**
+         * @brief Returns index of a user message.
+         *
+         * @param name      Message name, case sensitive.
+         *
+         * @return          Message index, 0 if message is not registered.
+         */
+        virtual int getUserMsgId(const char *name) const = 0;
+
+        /**
+         * @brief Returns name of a user message.
+         *
+         * @param msgid     Message index.
+         *
+         * @return          Message name, nullptr if message is not registered.
+         */
+        virtual const char *getUserMsgName(int msgid) const = 0;
+
+        /**
+         * @brief Returns size of a user message.
+         *
+         * @param msgid     Message index.
+         *
+         * @return          Size in bytes, -1 if it varies or message is not registered.
+         */
+        virtual int getUserMsgSize(int msgid) const = 0;
+
+        /**
+         * @brief Retrieves indexes of all registered user messages.
+         *
+         * @param ids       Buffer to store indexes.
+         * @param size      Size of the buffer.
+         *
+         * @return          Number of registered user messages,
+         *                  indexes beyond buffer size are not stored.
+         */
+        virtual std::size_t getUserMsgs(int *ids,
+                                        std::size_t size) const = 0;
+
+    protected:
+        virtual ~IMessageMngr() {};
+    };
+}
@@ -108,6 +108,17 @@ namespace SPMod
          */
         virtual bool isInGame() const = 0;
 
+        /**
+         * @brief Returns value of the player's userinfo key.
+         *
+         * @note Value is kept by the player until their next userinfo change.
+         *
+         * @param key       Userinfo key.
+         *
+         * @return          Value of the key, nullptr if the key is not set.
+         */
+        virtual const char *getUserInfo(const char *key) const = 0;
+
     protected:
         virtual ~IPlayer() {};
     };
@@ -185,6 +196,38 @@ namespace SPMod
         {
         }
 
+        /*
+         * @brief Called when a client receives their Steam ID.
+         *
+         * @param player        Player object.
+         * @param authid        Client's Steam ID.
+         *
+         * @noreturn
+         */
+        virtual void OnClientAuthorized(IPlayer *player [[maybe_unused]],
+                                        const char *authid [[maybe_unused]])
+        {
+        }
+
+        /*
+         * @brief Called when a userinfo key the listener subscribed to changes.
+         *
+         * @note Empty value means that the key is not set.
+         *
+         * @param player        Player object.
+         * @param key           Userinfo key.
+         * @param oldValue      Previous value of the key.
+         * @param newValue      New value of the key.
+         *
+         * @noreturn
+         */
+        virtual void OnClientUserInfoChanged(IPlayer *player [[maybe_unused]],
+                                             const char *key [[maybe_unused]],
+                                             const char *oldValue [[maybe_unused]],
+                                             const char *newValue [[maybe_unused]])
+        {
+        }
+
     protected:
         virtual ~IPlayerListener() {};
     };
@@ -244,6 +287,28 @@ namespace SPMod
          */
         virtual void removePlayerListener(IPlayerListener *listener) = 0;
 
+        /**
+         * @brief Subscribes player listener to changes of a userinfo key.
+         *
+         * @param key       Userinfo key.
+         * @param listener  Pointer to player listener instance.
+         *
+         * @noreturn
+         */
+        virtual void addUserInfoListener(const char *key,
+                                         IPlayerListener *listener) = 0;
+
+        /**
+         * @brief Unsubscribes player listener from changes of a userinfo key.
+         *
+         * @param key       Userinfo key.
+         * @param listener  Pointer to player listener instance.
+         *
+         * @noreturn
+         */
+        virtual void removeUserInfoListener(const char *key,
+                                            IPlayerListener *listener) = 0;
+
     protected:
         virtual ~IPlayerMngr() {};
     };
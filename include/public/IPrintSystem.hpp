@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2018 SPMod Development Team
+ *
+ *  This file is part of SPMod.
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SPMod
+{
+    /**
+     * @brief Places text can be printed to.
+     */
+    enum class PrintDest : uint8_t
+    {
+        Console = 0,
+        Center,
+        Chat
+    };
+
+    /**
+     * @brief When too much text is queued to a player, lower priority text is dropped first.
+     */
+    enum class PrintPriority : uint8_t
+    {
+        Low = 0,
+        Normal,
+        High
+    };
+
+    /**
+     * @brief Look of a HUD message.
+     */
+    struct HudParams
+    {
+        /* position, -1.0 centers the text */
+        float x = -1.0f;
+        float y = -1.0f;
+
+        /* 0 - fade in/out, 1 - flickery credits, 2 - write out */
+        int effect = 0;
+        uint8_t color[4] = { 255, 255, 255, 0 };
+        uint8_t effectColor[4] = { 255, 255, 255, 0 };
+        float fadeInTime = 0.1f;
+        float fadeOutTime = 0.2f;
+        float holdTime = 2.0f;
+        float fxTime = 0.0f;
+
+        /* text on the same channel replaces the previous one, from 1 to 4 */
+        int channel = 1;
+    };
+
+    class IPrintMngr
+    {
+    public:
+        /**
+         * @brief Queues text to be printed to a player.
+         *
+         * @note Text queued during a frame is sent at once in the fewest possible messages.
+         *
+         * @param player    Player index.
+         * @param dest      Where text is printed.
+         * @param text      Text to print, a new line is added to it.
+         * @param priority  Priority of the text.
+         *
+         * @return          True if text has been queued, false if player is not
+         *                  in game or there is no room for it.
+         */
+        virtual bool print(unsigned int player,
+                           PrintDest dest,
+                           const char *text,
+                           PrintPriority priority = PrintPriority::Normal) = 0;
+
+        /**
+         * @brief Queues HUD message to be shown to a player.
+         *
+         * @note Queued messages which look the same are merged.
+         *
+         * @param player    Player index.
+         * @param params    Look of the message.
+         * @param text      Text to show.
+         * @param priority  Priority of the text.
+         *
+         * @return          True if text has been queued, false if player is not
+         *                  in game, channel is invalid or there is no room for it.
+         */
+        virtual bool printHud(unsigned int player,
+                              const HudParams &params,
+                              const char *text,
+                              PrintPriority priority = PrintPriority::Normal) = 0;
+
+    protected:
+        virtual ~IPrintMngr() {};
+    };
+}
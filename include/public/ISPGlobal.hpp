@@ -51,11 +51,13 @@
 #include <IMenuSystem.hpp>
 #include <IUtilsSystem.hpp>
 #include <IPlayerSystem.hpp>
+#include <IMessageSystem.hpp>
+#include <IPrintSystem.hpp>
 
 namespace SPMod
 {
     using sp_api_t = unsigned long;
-    constexpr sp_api_t SPMOD_API_VERSION = 0;
+    constexpr sp_api_t SPMOD_API_VERSION = 1;
 
     class IModuleInterface;
 
@@ -159,6 +161,20 @@ namespace SPMod
                                         const cell_t *params,
                                         size_t param) const = 0;
 
+        /**
+         * @brief Return SPMod message manager.
+         *
+         * @return              Message manager.
+         */
+        virtual IMessageMngr *getMessageManager() const = 0;
+
+        /**
+         * @brief Return SPMod print manager.
+         *
+         * @return              Print manager.
+         */
+        virtual IPrintMngr *getPrintManager() const = 0;
+
     protected:
         virtual ~ISPGlobal() {};
     };
@@ -35,6 +35,130 @@ static cell_t PrintToServer(SourcePawn::IPluginContext *ctx,
     return 1;
 }
 
+// Queues text to a player or to everyone in game if client is 0
+template<typename F>
+static cell_t queuePrint(SourcePawn::IPluginContext *ctx,
+                         const cell_t *params,
+                         cell_t client,
+                         std::size_t formatParam,
+                         F &&print)
+{
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
+
+    if (client < 0 || client > static_cast<cell_t>(plrMngr->getMaxClients()))
+    {
+        ctx->ReportError("Invalid player index (%d)", client);
+        return 0;
+    }
+
+    char *formatString;
+    char bufferOutput[1024];
+
+    ctx->LocalToString(params[formatParam], &formatString);
+    std::size_t res = gSPGlobal->formatString(bufferOutput, sizeof(bufferOutput), formatString, ctx, params, formatParam + 1);
+    std::string_view text(bufferOutput, res);
+
+    if (client)
+        return print(plrMngr->getPlayerCore(client), text);
+
+    for (unsigned int i = 1; i <= plrMngr->getMaxClients(); i++)
+    {
+        Player *plr = plrMngr->getPlayerCore(i);
+        if (plr->isInGame())
+            print(plr, text);
+    }
+
+    return 1;
+}
+
+// native bool PrintToClient(int client, PrintDest dest, PrintPriority priority, const char[] text, any ...)
+static cell_t PrintToClient(SourcePawn::IPluginContext *ctx,
+                            const cell_t *params)
+{
+    enum { arg_client = 1, arg_dest, arg_priority, arg_text };
+
+    if (params[arg_dest] < 0 || params[arg_dest] > static_cast<cell_t>(PrintDest::Chat))
+    {
+        ctx->ReportError("Invalid print destination (%d)", params[arg_dest]);
+        return 0;
+    }
+
+    auto dest = static_cast<PrintDest>(params[arg_dest]);
+    auto priority = static_cast<PrintPriority>(std::clamp(params[arg_priority], 0, static_cast<cell_t>(PrintPriority::High)));
+    const std::unique_ptr<PrintMngr> &printMngr = gSPGlobal->getPrintManagerCore();
+
+    return queuePrint(ctx, params, params[arg_client], arg_text, [&](Player *plr, std::string_view text)
+    {
+        return printMngr->printCore(plr, dest, text, priority);
+    });
+}
+
+static cell_t printToDest(SourcePawn::IPluginContext *ctx,
+                          const cell_t *params,
+                          PrintDest dest)
+{
+    enum { arg_client = 1, arg_text };
+
+    const std::unique_ptr<PrintMngr> &printMngr = gSPGlobal->getPrintManagerCore();
+
+    return queuePrint(ctx, params, params[arg_client], arg_text, [&](Player *plr, std::string_view text)
+    {
+        return printMngr->printCore(plr, dest, text, PrintPriority::Normal);
+    });
+}
+
+// native bool PrintToConsole(int client, const char[] text, any ...)
+static cell_t PrintToConsole(SourcePawn::IPluginContext *ctx,
+                             const cell_t *params)
+{
+    return printToDest(ctx, params, PrintDest::Console);
+}
+
+// native bool PrintToCenter(int client, const char[] text, any ...)
+static cell_t PrintToCenter(SourcePawn::IPluginContext *ctx,
+                            const cell_t *params)
+{
+    return printToDest(ctx, params, PrintDest::Center);
+}
+
+// native bool PrintToChat(int client, const char[] text, any ...)
+static cell_t PrintToChat(SourcePawn::IPluginContext *ctx,
+                          const cell_t *params)
+{
+    return printToDest(ctx, params, PrintDest::Chat);
+}
+
+// native bool PrintToHud(int client, int channel, float x, float y, const int color[4], float holdTime, const char[] text, any ...)
+static cell_t PrintToHud(SourcePawn::IPluginContext *ctx,
+                         const cell_t *params)
+{
+    enum { arg_client = 1, arg_channel, arg_x, arg_y, arg_color, arg_holdtime, arg_text };
+
+    if (params[arg_channel] < 1 || params[arg_channel] > 4)
+    {
+        ctx->ReportError("Invalid HUD channel (%d)", params[arg_channel]);
+        return 0;
+    }
+
+    HudParams hud;
+    hud.channel = params[arg_channel];
+    hud.x = sp_ctof(params[arg_x]);
+    hud.y = sp_ctof(params[arg_y]);
+    hud.holdTime = sp_ctof(params[arg_holdtime]);
+
+    cell_t *color;
+    ctx->LocalToPhysAddr(params[arg_color], &color);
+    for (std::size_t i = 0; i < 4; i++)
+        hud.color[i] = static_cast<uint8_t>(std::clamp(color[i], 0, 255));
+
+    const std::unique_ptr<PrintMngr> &printMngr = gSPGlobal->getPrintManagerCore();
+
+    return queuePrint(ctx, params, params[arg_client], arg_text, [&](Player *plr, std::string_view text)
+    {
+        return printMngr->printHudCore(plr, hud, text, PrintPriority::Normal);
+    });
+}
+
 // native int PrecacheModel(const char[] model)
 static cell_t PrecacheModel(SourcePawn::IPluginContext *ctx,
                                     const cell_t *params)
@@ -313,6 +437,11 @@ static cell_t ServerExec(SourcePawn::IPluginContext *ctx [[maybe_unused]],
 sp_nativeinfo_t gCoreNatives[] =
 {
     {  "PrintToServer",          PrintToServer       },
+    {  "PrintToClient",          PrintToClient       },
+    {  "PrintToConsole",         PrintToConsole      },
+    {  "PrintToCenter",          PrintToCenter       },
+    {  "PrintToChat",            PrintToChat         },
+    {  "PrintToHud",             PrintToHud          },
     {  "PrecacheModel",          PrecacheModel       },
     {  "PrecacheSound",          PrecacheSound       },
     {  "PrecacheGeneric",        PrecacheGeneric     },
@@ -44,11 +44,16 @@ std::shared_ptr<Cvar> CvarMngr::registerCvarCore(std::string_view name,
     }
     else
     {
-        // Else create and register
-        cvar_t new_cvar;
-        new_cvar.name = name.data();
+        // Else create and register, engine keeps the pointer so cvar has to outlive this call
+        auto &engineCvar = m_engineCvars.emplace_back(std::make_unique<EngineCvar>());
+        engineCvar->name = name;
+
+        cvar_t &new_cvar = engineCvar->cvar;
+        new_cvar.name = engineCvar->name.c_str();
         new_cvar.string = const_cast<char *>("");
         new_cvar.flags = static_cast<int>(flags);
+        new_cvar.value = 0.0f;
+        new_cvar.next = nullptr;
 
         CVAR_REGISTER(&new_cvar);
 
@@ -63,10 +68,7 @@ std::shared_ptr<Cvar> CvarMngr::registerCvarCore(std::string_view name,
         cvar = std::make_shared<Cvar>(name, m_id, value, flags, pcvar);
     }
 
-    // Always add to cache
-    m_cvars.emplace(name, cvar);
-    // Raise cvar num
-    m_id++;
+    _cacheCvar(cvar);
     return cvar;
 }
 
@@ -90,37 +92,84 @@ std::shared_ptr<Cvar> CvarMngr::findCvarCore(std::string_view name,
     if (pcvar)
     {
         std::shared_ptr<Cvar> cvar = std::make_shared<Cvar>(name, m_id, pcvar->string, static_cast<ICvar::Flags>(pcvar->flags), pcvar);
-        // Always add to cache
-        m_cvars.emplace(name, cvar);
-        // Raise cvar num
-        m_id++;
+        _cacheCvar(cvar);
         return cvar;
     }
     // Not found
     return nullptr;
 }
 
-std::shared_ptr<Cvar> CvarMngr::findCvarCore(std::size_t id)
+std::shared_ptr<Cvar> CvarMngr::findCvarCore(const cvar_t *pcvar)
 {
-    for (auto pair = m_cvars.begin(); pair != m_cvars.end(); pair++)
-    {
-        if (pair->second->getId() == id)
-            return pair->second;
-    }
+    auto pair = m_cvarsByPointer.find(pcvar);
+    if (pair != m_cvarsByPointer.end())
+        return pair->second;
 
     return nullptr;
 }
 
+void CvarMngr::_cacheCvar(std::shared_ptr<Cvar> cvar)
+{
+    m_cvars.emplace(cvar->getNameCore(), cvar);
+    m_cvarsById.push_back(cvar);
+    m_cvarsByPointer.emplace(cvar->getEngineCvar(), cvar);
+
+    // Raise cvar num
+    m_id++;
+}
+
+std::shared_ptr<Cvar> CvarMngr::findCvarCore(std::size_t id)
+{
+    if (id >= m_cvarsById.size())
+        return nullptr;
+
+    return m_cvarsById[id];
+}
+
 void CvarMngr::clearCvars()
 {
     m_cvars.clear();
+    m_cvarsById.clear();
+    m_cvarsByPointer.clear();
+    m_dirtyCvars.clear();
     m_id = 0;
 }
 
 void CvarMngr::clearCvarsCallback()
 {
     for (auto pair : m_cvars)
+    {
         pair.second->clearCallback();
+        pair.second->clearBindings();
+    }
+
+    m_dirtyCvars.clear();
+}
+
+void CvarMngr::markDirty(std::size_t id)
+{
+    m_dirtyCvars.push_back(id);
+}
+
+void CvarMngr::unmarkDirty(std::size_t id)
+{
+    m_dirtyCvars.erase(std::remove(m_dirtyCvars.begin(), m_dirtyCvars.end(), id), m_dirtyCvars.end());
+}
+
+void CvarMngr::runDeferredCallbacks()
+{
+    if (m_dirtyCvars.empty())
+        return;
+
+    // Changes made by callbacks are handled next frame
+    std::vector<std::size_t> dirtyCvars;
+    dirtyCvars.swap(m_dirtyCvars);
+
+    for (std::size_t id : dirtyCvars)
+    {
+        if (std::shared_ptr<Cvar> cvar = findCvarCore(id); cvar)
+            cvar->runDeferredCallbacks();
+    }
 }
 
 Cvar::Cvar(std::string_view name,
@@ -132,7 +181,9 @@ Cvar::Cvar(std::string_view name,
                             m_value(value),
                             m_id(id),
                             m_cvar(pcvar)
-{}
+{
+    _parseValue();
+}
 
 const char *Cvar::getName() const
 {
@@ -151,12 +202,18 @@ std::size_t Cvar::getId() const
 
 void Cvar::setValue(float val)
 {
-    setValueCore(std::to_string(val));
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%f", val);
+
+    setValueCore(buffer);
 }
 
 void Cvar::setValue(int val)
 {
-    setValueCore(std::to_string(val));
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%d", val);
+
+    setValueCore(buffer);
 }
 
 void Cvar::setValue(const char *val)
@@ -172,26 +229,12 @@ void Cvar::setFlags(Flags flags)
 
 int Cvar::asInt() const
 {
-    try
-    {
-        return std::stoi(m_value, nullptr, 0);
-    }
-    catch (const std::exception &e [[maybe_unused]])
-    {
-        return 0;
-    }
+    return m_intValue;
 }
 
 float Cvar::asFloat() const
 {
-    try
-    {
-        return std::stof(m_value);
-    }
-    catch (const std::exception &e [[maybe_unused]])
-    {
-        return 0.0f;
-    }
+    return m_floatValue;
 }
 
 const char *Cvar::asString() const
@@ -209,6 +252,11 @@ std::string_view Cvar::getNameCore() const
     return m_name;
 }
 
+const cvar_t *Cvar::getEngineCvar() const
+{
+    return m_cvar;
+}
+
 void Cvar::addCallback(cvarCallback_t callback)
 {
     m_callbacks.push_back(callback);
@@ -216,7 +264,7 @@ void Cvar::addCallback(cvarCallback_t callback)
 
 void Cvar::addPluginCallback(SourcePawn::IPluginFunction *callback)
 {
-    m_plugin_callbacks.push_back(callback);
+    m_plugin_callbacks.push_back({ callback, false });
 }
 
 void Cvar::runCallbacks(std::string_view old_value,
@@ -227,24 +275,171 @@ void Cvar::runCallbacks(std::string_view old_value,
     {
         callback(this, old_value.data(), new_value.data());
     }
-    for (auto callback : m_plugin_callbacks)
-    {            
+
+    _runPluginCallbacks(old_value, new_value, false);
+}
+
+void Cvar::_runPluginCallbacks(std::string_view old_value,
+                               std::string_view new_value,
+                               bool deferred)
+{
+    // Callbacks can add new hooks, so vector is walked by index
+    for (std::size_t i = 0; i < m_plugin_callbacks.size(); ++i)
+    {
+        if (m_plugin_callbacks[i].deferred != deferred)
+            continue;
+
+        SourcePawn::IPluginFunction *callback = m_plugin_callbacks[i].func;
+
+        // Plugin has been paused
+        if (!callback->IsRunnable())
+            continue;
+
         callback->PushCell(static_cast<cell_t>(m_id));
         callback->PushString(old_value.data());
         callback->PushString(new_value.data());
-        callback->Execute(nullptr);
+        {
+            Profiler::Scope profile(callback, Profiler::Source::Cvar);
+            callback->Execute(nullptr);
+        }
     }
 }
 
+bool Cvar::_hasDeferredCallbacks() const
+{
+    return std::any_of(m_plugin_callbacks.begin(), m_plugin_callbacks.end(), [](const PluginCallback &callback)
+    {
+        return callback.deferred;
+    });
+}
+
 void Cvar::clearCallback()
 {
     m_callbacks.clear();
     m_plugin_callbacks.clear();
+
+    // Nobody is left to be told about pending change
+    m_dirty = false;
+}
+
+void Cvar::addBinding(cell_t *address,
+                      BindType type,
+                      std::size_t size)
+{
+    const Binding &binding = m_bindings.emplace_back(Binding{ address, type, size });
+
+    // Variable holds current value from the start
+    _writeBinding(binding);
+}
+
+void Cvar::clearBindings()
+{
+    m_bindings.clear();
+}
+
+void Cvar::setDeferredCallbacks(SourcePawn::IPluginRuntime *owner,
+                                bool deferred)
+{
+    // Pending change is delivered before any hook switches its mode
+    if (m_dirty)
+    {
+        runDeferredCallbacks();
+        gSPGlobal->getCvarManagerCore()->unmarkDirty(m_id);
+    }
+
+    // Only hooks of the plugin which opted in are deferred
+    for (auto &callback : m_plugin_callbacks)
+    {
+        if (callback.func->GetParentRuntime() == owner)
+            callback.deferred = deferred;
+    }
+}
+
+void Cvar::runDeferredCallbacks()
+{
+    if (!m_dirty)
+        return;
+
+    m_dirty = false;
+
+    // Callbacks can set the cvar again, which overwrites both members
+    std::string oldValue = std::move(m_deferredValue);
+    std::string newValue = m_value;
+
+    // Value could have been set back in the meantime
+    if (oldValue != newValue)
+        _runPluginCallbacks(oldValue, newValue, true);
+}
+
+void Cvar::_writeBinding(const Binding &binding) const
+{
+    switch (binding.type)
+    {
+        case BindType::Int:
+        {
+            *binding.address = static_cast<cell_t>(m_intValue);
+            break;
+        }
+        case BindType::Float:
+        {
+            *binding.address = sp_ftoc(m_floatValue);
+            break;
+        }
+        case BindType::String:
+        {
+            gSPGlobal->getUtilsCore()->strCopyCore(reinterpret_cast<char *>(binding.address), binding.size, m_value);
+            break;
+        }
+    }
 }
 
 void Cvar::setValueCore(std::string_view val)
 {
-    runCallbacks(m_value, val);
-    m_value.assign(val);
+    updateValueCore(val);
     g_engfuncs.pfnCvar_DirectSet(m_cvar, val.data());
 }
+
+void Cvar::updateValueCore(std::string_view val)
+{
+    if (!m_callbacks.empty() || !m_plugin_callbacks.empty())
+    {
+        if (!m_dirty && _hasDeferredCallbacks())
+        {
+            // Remember only the first old value, deferred callbacks get it with the last new value
+            m_deferredValue = m_value;
+            m_dirty = true;
+            gSPGlobal->getCvarManagerCore()->markDirty(m_id);
+        }
+
+        runCallbacks(m_value, val);
+    }
+
+    m_value.assign(val);
+    _parseValue();
+
+    for (const auto &binding : m_bindings)
+        _writeBinding(binding);
+}
+
+void Cvar::_parseValue()
+{
+    const char *value = m_value.c_str();
+
+    // Base is detected like before, so hex values are still accepted
+    m_intValue = static_cast<int>(std::strtol(value, nullptr, 0));
+
+#if defined __cpp_lib_to_chars
+    const char *begin = value;
+    const char *end = value + m_value.length();
+
+    // from_chars accepts neither leading whitespaces nor plus sign
+    while (begin != end && (std::isspace(static_cast<unsigned char>(*begin)) || *begin == '+'))
+        begin++;
+
+    if (std::from_chars(begin, end, m_floatValue).ec != std::errc())
+        m_floatValue = 0.0f;
+#else
+    // Standard library without floating point from_chars
+    m_floatValue = std::strtof(value, nullptr);
+#endif
+}
@@ -24,6 +24,14 @@ class Plugin;
 class Cvar final : public ICvar
 {
 public:
+    /* how cvar value is written into bound plugin variable */
+    enum class BindType : uint8_t
+    {
+        Int = 0,
+        Float,
+        String
+    };
+
     Cvar(std::string_view name,
          std::size_t id, 
          std::string_view value,
@@ -45,22 +53,62 @@ public:
     const char *asString() const override;
     std::string_view asStringCore() const;
     std::string_view getNameCore() const;
+    const cvar_t *getEngineCvar() const;
     void addCallback(cvarCallback_t callback) override;
     void addPluginCallback(SourcePawn::IPluginFunction *callback) override;
     void runCallbacks(std::string_view old_value,
                       std::string_view new_value);
 
     void clearCallback();
+    void addBinding(cell_t *address,
+                    BindType type,
+                    std::size_t size);
+    void clearBindings();
+    void setDeferredCallbacks(SourcePawn::IPluginRuntime *owner,
+                              bool deferred);
+    void runDeferredCallbacks();
     void setValueCore(std::string_view val);
+    void updateValueCore(std::string_view val);
 
 private:
+    /* plugin variable updated on every change */
+    struct Binding
+    {
+        cell_t *address;
+        BindType type;
+        std::size_t size;
+    };
+
+    /* plugin hook, deferred ones are run once per frame instead of on every change */
+    struct PluginCallback
+    {
+        SourcePawn::IPluginFunction *func;
+        bool deferred;
+    };
+
+    void _parseValue();
+    void _writeBinding(const Binding &binding) const;
+    void _runPluginCallbacks(std::string_view old_value,
+                             std::string_view new_value,
+                             bool deferred);
+    bool _hasDeferredCallbacks() const;
+
     Flags       m_flags;
     std::string m_name;
     std::string m_value;
+    int         m_intValue;
+    float       m_floatValue;
     std::size_t      m_id;
     cvar_t      *m_cvar;
     std::vector<cvarCallback_t> m_callbacks;
-    std::vector<SourcePawn::IPluginFunction*> m_plugin_callbacks;
+    std::vector<PluginCallback> m_plugin_callbacks;
+    std::vector<Binding> m_bindings;
+
+    /* changed since deferred callbacks were last run */
+    bool m_dirty = false;
+
+    /* value before the first change in current frame */
+    std::string m_deferredValue;
 };
 
 
@@ -83,11 +131,37 @@ public:
                                        bool cacheonly);
 
     std::shared_ptr<Cvar> findCvarCore(std::size_t id);
+    std::shared_ptr<Cvar> findCvarCore(const cvar_t *pcvar);
     void clearCvars();
     void clearCvarsCallback();
+    void markDirty(std::size_t id);
+    void unmarkDirty(std::size_t id);
+    void runDeferredCallbacks();
 
 private:
+    /* cvar registered by SPMod, kept alive as engine stores pointers to it */
+    struct EngineCvar
+    {
+        std::string name;
+        cvar_t cvar;
+    };
+
+    void _cacheCvar(std::shared_ptr<Cvar> cvar);
+
     std::unordered_map<std::string, std::shared_ptr<Cvar>> m_cvars;
+
+    /* cached cvars, cvar id is its position */
+    std::vector<std::shared_ptr<Cvar>> m_cvarsById;
+
+    /* cached cvars by engine cvar, checked on every cvar change in the engine */
+    std::unordered_map<const cvar_t *, std::shared_ptr<Cvar>> m_cvarsByPointer;
+
+    /* cvars registered by SPMod */
+    std::vector<std::unique_ptr<EngineCvar>> m_engineCvars;
+
+    /* ids of cvars with pending deferred callbacks, in order of their first change */
+    std::vector<std::size_t> m_dirtyCvars;
+
     /* keeps track of cvar ids */
     std::size_t m_id = 0;
 };
@@ -266,6 +266,111 @@ static cell_t CvarSetFlags(SourcePawn::IPluginContext *ctx,
     return 1;
 }
 
+// Plugin doesn't tell sizes of its variables, so buffer can't reach next public variable or leave plugin memory
+static bool isPubvarExtent(SourcePawn::IPluginContext *ctx,
+                           cell_t localAddr,
+                           cell_t size)
+{
+    if (size > std::numeric_limits<cell_t>::max() - localAddr)
+        return false;
+
+    SourcePawn::IPluginRuntime *runtime = ctx->GetRuntime();
+    cell_t lastAddr = localAddr + size - 1;
+
+    uint32_t pubvarsNum = runtime->GetPubvarsNum();
+    for (uint32_t index = 0; index < pubvarsNum; ++index)
+    {
+        cell_t otherAddr, *otherPhysAddr;
+        runtime->GetPubvarAddrs(index, &otherAddr, &otherPhysAddr);
+
+        if (otherAddr > localAddr && otherAddr <= lastAddr)
+            return false;
+    }
+
+    cell_t *physAddr;
+    return ctx->LocalToPhysAddr(lastAddr, &physAddr) == SP_ERROR_NONE;
+}
+
+static cell_t CvarBindToPubvar(SourcePawn::IPluginContext *ctx,
+                              const cell_t *params)
+{
+    using BindType = Cvar::BindType;
+    enum { arg_index = 1, arg_pubvar, arg_type, arg_size };
+    cell_t cvarId = params[arg_index];
+    if (cvarId < 0)
+    {
+        ctx->ReportError("Invalid cvar pointer!");
+        return 0;
+    }
+    const std::unique_ptr<CvarMngr> &cvarMngr = gSPGlobal->getCvarManagerCore();
+    auto cvar = cvarMngr->findCvarCore(cvarId);
+    if (!cvar)
+    {
+        ctx->ReportError("Cvar not found!");
+        return 0;
+    }
+
+    auto type = static_cast<BindType>(params[arg_type]);
+    if (type != BindType::Int && type != BindType::Float && type != BindType::String)
+    {
+        ctx->ReportError("Invalid bind type %d!", params[arg_type]);
+        return 0;
+    }
+
+    if (type == BindType::String && params[arg_size] <= 0)
+    {
+        ctx->ReportError("Invalid buffer size %d!", params[arg_size]);
+        return 0;
+    }
+
+    // Only public variables are accepted as they are guaranteed to outlive the binding
+    char *pubvarName;
+    ctx->LocalToString(params[arg_pubvar], &pubvarName);
+
+    SourcePawn::IPluginRuntime *runtime = ctx->GetRuntime();
+    uint32_t pubvarIndex;
+    if (runtime->FindPubvarByName(pubvarName, &pubvarIndex) != SP_ERROR_NONE)
+    {
+        ctx->ReportError("Public variable %s not found!", pubvarName);
+        return 0;
+    }
+
+    cell_t localAddr, *physAddr;
+    runtime->GetPubvarAddrs(pubvarIndex, &localAddr, &physAddr);
+
+    if (type == BindType::String && !isPubvarExtent(ctx, localAddr, params[arg_size]))
+    {
+        ctx->ReportError("Buffer size %d exceeds public variable %s!", params[arg_size], pubvarName);
+        return 0;
+    }
+
+    cvar->addBinding(physAddr, type, static_cast<std::size_t>(params[arg_size]));
+
+    return 1;
+}
+
+static cell_t CvarSetDeferredHooks(SourcePawn::IPluginContext *ctx,
+                                  const cell_t *params)
+{
+    enum { arg_index = 1, arg_deferred };
+    cell_t cvarId = params[arg_index];
+    if (cvarId < 0)
+    {
+        ctx->ReportError("Invalid cvar pointer!");
+        return 0;
+    }
+    const std::unique_ptr<CvarMngr> &cvarMngr = gSPGlobal->getCvarManagerCore();
+    auto cvar = cvarMngr->findCvarCore(cvarId);
+    if (!cvar)
+    {
+        ctx->ReportError("Cvar not found!");
+        return 0;
+    }
+    cvar->setDeferredCallbacks(ctx->GetRuntime(), params[arg_deferred] != 0);
+
+    return 1;
+}
+
 static cell_t CvarFind(SourcePawn::IPluginContext *ctx,
                        const cell_t *params)
 {
@@ -303,6 +408,8 @@ sp_nativeinfo_t gCvarsNatives[] =
     { "Cvar.Flags.set",         CvarSetFlags    },
 
     { "Cvar.AddHookOnChange",   CvarAddCallback },
+    { "Cvar.BindToPubvar",      CvarBindToPubvar },
+    { "Cvar.SetDeferredHooks",  CvarSetDeferredHooks },
 
     { "FindCvar",               CvarFind        },
     { nullptr,                  nullptr         }
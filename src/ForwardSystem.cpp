@@ -218,21 +218,40 @@ bool MultiForward::execFunc(cell_t *result)
     if (m_paramsNum > m_currentPos)
         return false;
 
+    const std::unique_ptr<PluginMngr> &plMngr = gSPGlobal->getPluginManagerCore();
+    const auto &pluginsList = plMngr->getPluginsList();
+
+    // Plugins loaded during the execution are appended to the list so they are not reached,
+    // if any plugin gets removed, epoch changes and execution stops
+    std::size_t pluginsNum = pluginsList.size();
+    std::size_t epoch = plMngr->getEpoch();
+
     m_exec = true;
     cell_t tempResult = 0, returnValue = 0;
-    for (const auto &pair : gSPGlobal->getPluginManagerCore()->getPluginsList())
+    for (std::size_t i = 0; i < pluginsNum && epoch == plMngr->getEpoch(); ++i)
     {
-        std::shared_ptr<Plugin> plugin = pair.second;
+        std::shared_ptr<Plugin> plugin = pluginsList[i];
+
+        // Plugins paused by watchdog do not receive forwards
+        if (plugin->isPaused())
+            continue;
+
         SourcePawn::IPluginFunction *funcToExecute = plugin->getRuntime()->GetFunctionByName(m_name.c_str());
 
-        if (!funcToExecute)
+        if (!funcToExecute || plugin->isFunctionDisabled(funcToExecute))
             continue;
 
         // Pass params if there are any
         if (m_paramsNum)
             pushParamsToFunction(funcToExecute);
 
-        if (funcToExecute->Execute(&tempResult) != SP_ERROR_NONE)
+        int error;
+        {
+            Profiler::Scope profile(funcToExecute, Profiler::Source::Forward);
+            error = funcToExecute->Execute(&tempResult);
+        }
+
+        if (error != SP_ERROR_NONE)
         {
             m_exec = false;
             return false;
@@ -472,8 +491,26 @@ bool SingleForward::execFunc(cell_t *result)
     if (m_paramsNum > m_currentPos)
         return false;
 
+    // Plugin has been paused
+    if (!m_pluginFunc->IsRunnable())
+    {
+        m_pluginFunc->Cancel();
+        return false;
+    }
+
+    // Function keeps throwing errors, skip it until its cooldown passes
+    if (std::shared_ptr<Plugin> plugin = m_plugin.lock(); plugin && plugin->isFunctionDisabled(m_pluginFunc))
+    {
+        m_pluginFunc->Cancel();
+        return false;
+    }
+
     m_exec = true;
-    bool succeed = m_pluginFunc->Execute(result) == SP_ERROR_NONE;
+    bool succeed;
+    {
+        Profiler::Scope profile(m_pluginFunc, Profiler::Source::Forward);
+        succeed = m_pluginFunc->Execute(result) == SP_ERROR_NONE;
+    }
     m_exec = false;
 
     return succeed;
@@ -590,37 +627,41 @@ void ForwardMngr::addDefaultsForwards()
 
     auto posId = defToId(FwdDefault::ClientConnect);
     paramsList = {{ param::Cell, param::String, param::String, param::String }};
-    m_defaultForwards.at(posId) = createForwardCore("OnClientConnect", et::Stop, paramsList, 4);
+    m_defaultForwards.at(posId) = createForwardCore("OnClientConnect", et::Stop, paramsList, 4).get();
 
     posId = defToId(FwdDefault::ClientDisconnect);
     paramsList = {{ param::Cell, param::Cell, param::String }};
-    m_defaultForwards.at(posId) = createForwardCore("OnClientDisconnect", et::Ignore, paramsList, 3);
+    m_defaultForwards.at(posId) = createForwardCore("OnClientDisconnect", et::Ignore, paramsList, 3).get();
     
     posId = defToId(FwdDefault::ClientPutInServer);
     paramsList = {{ param::Cell }};
-    m_defaultForwards.at(posId) = createForwardCore("OnClientPutInServer", et::Ignore, paramsList, 1);
+    m_defaultForwards.at(posId) = createForwardCore("OnClientPutInServer", et::Ignore, paramsList, 1).get();
 
     posId = defToId(FwdDefault::ClientCommmand);
     paramsList = {{ param::Cell }};
-    m_defaultForwards.at(posId) = createForwardCore("OnClientCommand", et::Stop, paramsList, 1);
+    m_defaultForwards.at(posId) = createForwardCore("OnClientCommand", et::Stop, paramsList, 1).get();
+
+    posId = defToId(FwdDefault::ClientAuthorized);
+    paramsList = {{ param::Cell, param::String }};
+    m_defaultForwards.at(posId) = createForwardCore("OnClientAuthorized", et::Ignore, paramsList, 2).get();
 
     posId = defToId(FwdDefault::MapChange);
     paramsList = {{ param::String }};
-    m_defaultForwards.at(posId) = createForwardCore("OnMapChange", et::Stop, paramsList, 1);
+    m_defaultForwards.at(posId) = createForwardCore("OnMapChange", et::Stop, paramsList, 1).get();
 
     paramsList = { };
 
     posId = defToId(FwdDefault::PluginsLoaded);
-    m_defaultForwards.at(posId) = createForwardCore("OnPluginsLoaded", et::Ignore, paramsList, 0);
+    m_defaultForwards.at(posId) = createForwardCore("OnPluginsLoaded", et::Ignore, paramsList, 0).get();
 
     posId = defToId(FwdDefault::PluginInit);
-    m_defaultForwards.at(posId) = createForwardCore("OnPluginInit", et::Ignore, paramsList, 0);
+    m_defaultForwards.at(posId) = createForwardCore("OnPluginInit", et::Ignore, paramsList, 0).get();
 
     posId = defToId(FwdDefault::PluginEnd);
-    m_defaultForwards.at(posId) = createForwardCore("OnPluginEnd", et::Ignore, paramsList, 0);
+    m_defaultForwards.at(posId) = createForwardCore("OnPluginEnd", et::Ignore, paramsList, 0).get();
 
     posId = defToId(FwdDefault::PluginNatives);
-    m_defaultForwards.at(posId) = createForwardCore("OnPluginNatives", et::Ignore, paramsList, 0);
+    m_defaultForwards.at(posId) = createForwardCore("OnPluginNatives", et::Ignore, paramsList, 0).get();
 }
 
 std::shared_ptr<Forward> ForwardMngr::_createForwardVa(std::string_view name,
@@ -680,6 +721,7 @@ std::shared_ptr<Forward> ForwardMngr::createForwardCore(std::string_view name,
 
 void ForwardMngr::deleteForward(IForward *forward)
 {
+    _forgetDefaultForward(static_cast<Forward *>(forward));
     m_forwards.erase(forward->getName());
 }
 
@@ -691,15 +733,26 @@ std::size_t ForwardMngr::getForwardsNum() const
 void ForwardMngr::clearForwards()
 {
     m_forwards.clear();
+    m_defaultForwards = {};
     m_id = 0;
 }
 
 void ForwardMngr::deleteForwardCore(std::shared_ptr<Forward> fwd)
 {
+    _forgetDefaultForward(fwd.get());
     m_forwards.erase(fwd->getNameCore().data());
 }
 
-std::shared_ptr<Forward> ForwardMngr::getDefaultForward(ForwardMngr::FwdDefault fwd) const
+Forward *ForwardMngr::getDefaultForward(ForwardMngr::FwdDefault fwd) const
+{
+    return m_defaultForwards[static_cast<std::size_t>(fwd)];
+}
+
+void ForwardMngr::_forgetDefaultForward(const Forward *forward)
 {
-    return m_defaultForwards.at(static_cast<std::size_t>(fwd)).lock();
+    for (auto &defaultForward : m_defaultForwards)
+    {
+        if (defaultForward == forward)
+            defaultForward = nullptr;
+    }
 }
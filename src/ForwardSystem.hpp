@@ -210,6 +210,7 @@ public:
         PluginNatives,
         ClientCommmand,
         MapChange,
+        ClientAuthorized,
 
         /* number of defaults forwards */
         ForwardsNum,
@@ -238,7 +239,7 @@ public:
     // ForwardMngr
     void clearForwards();
     void deleteForwardCore(std::shared_ptr<Forward> fwd);
-    std::shared_ptr<Forward> getDefaultForward(ForwardMngr::FwdDefault fwd) const;
+    Forward *getDefaultForward(ForwardMngr::FwdDefault fwd) const;
 
     void addDefaultsForwards();
 
@@ -251,6 +252,8 @@ public:
     std::shared_ptr<Forward> findForward(std::size_t id) const;
 
 private:
+    void _forgetDefaultForward(const Forward *forward);
+
     std::shared_ptr<Forward> _createForwardVa(std::string_view name,
                                               IForward::ExecType exec,
                                               std::va_list params,
@@ -262,6 +265,6 @@ private:
     /* keeps track of forwards ids */ 
     std::size_t m_id;
 
-    /* cache for defaults forwards */
-    std::array<std::weak_ptr<Forward>, defaultForwardsNum> m_defaultForwards;
+    /* cache for defaults forwards, owned by m_forwards and reset whenever they are removed */
+    std::array<Forward *, defaultForwardsNum> m_defaultForwards = {};
 };
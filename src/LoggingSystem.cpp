@@ -41,6 +41,9 @@ void Logger::ReportError(const SourcePawn::IErrorReport &report,
         return pluginIdentity;
     };
 
+    // Whole report is flushed at once
+    m_reportingError = true;
+
     LogErrorCore("Run time error ", report.Code(), ": ", spErrorMsg);
     LogErrorCore("Error: ", report.Message());
 
@@ -55,6 +58,12 @@ void Logger::ReportError(const SourcePawn::IErrorReport &report,
             LogErrorCore("   Plugin: ", getPluginIdentity(report.Context()));
     }
 
+    if (report.Code() == SP_ERROR_TIMEOUT && report.Context())
+        _handleWatchdogTimeout(report.Context());
+
+    if (report.Blame() && report.Context())
+        _handleFunctionError(report.Context(), report.Blame());
+
     if (!iter.Done())
         LogErrorCore("Stack trace:");
 
@@ -92,11 +101,44 @@ void Logger::ReportError(const SourcePawn::IErrorReport &report,
         ++entryPos;
         iter.Next();
     }
+
+    m_reportingError = false;
+    m_errorFile.flush();
+}
+
+void Logger::_handleWatchdogTimeout(SourcePawn::IPluginContext *ctx)
+{
+    std::shared_ptr<Plugin> plugin = gSPGlobal->getPluginManagerCore()->getPluginCore(ctx);
+    if (!plugin)
+        return;
+
+    std::size_t strikes = plugin->addWatchdogStrike();
+    auto strikesLimit = static_cast<int>(gCvarWatchdogStrikes.value);
+
+    // Keep repeat offenders from stalling the server
+    if (strikesLimit > 0 && strikes >= static_cast<std::size_t>(strikesLimit) && !plugin->isPaused())
+    {
+        plugin->setPaused(true);
+        LogErrorCore("Plugin ", plugin->getIndentityCore(), " has been paused after ", strikes, " watchdog timeouts");
+    }
+}
+
+void Logger::_handleFunctionError(SourcePawn::IPluginContext *ctx,
+                                  SourcePawn::IPluginFunction *func)
+{
+    std::shared_ptr<Plugin> plugin = gSPGlobal->getPluginManagerCore()->getPluginCore(ctx);
+    if (!plugin || !plugin->addFunctionError(func))
+        return;
+
+    LogErrorCore("Function ", func->DebugName(), " of plugin ", plugin->getIndentityCore(),
+                 " has been disabled for ", gCvarBreakerCooldown.value, " seconds due to repeated errors");
 }
 
 void Logger::resetErrorState()
 {
     m_alreadyReportedError = false;
+    m_errorFile.close();
+    m_errorFileName.clear();
 }
 
 void Logger::_writeErrorToFile(std::string_view errormsg)
@@ -121,7 +163,15 @@ void Logger::_writeErrorToFile(std::string_view errormsg)
     std::strftime(logDateTime, sizeof(logDateTime), "%Y/%m/%d - %H:%M:%S: ", &convertedTime);
     std::strftime(fileName, sizeof(fileName), "error_%Y%m%d.log", &convertedTime);
 
-    std::fstream errorFile(gSPGlobal->getLogsDirCore() / fileName, fFlags::out | fFlags::app);
+    // Keep the file open as long as the date does not change
+    if (!m_errorFile.is_open() || m_errorFileName != fileName)
+    {
+        m_errorFile.close();
+        m_errorFile.open(gSPGlobal->getLogsDirCore() / fileName, fFlags::out | fFlags::app);
+        m_errorFileName = fileName;
+    }
+
+    std::ofstream &errorFile = m_errorFile;
 
     if (!m_alreadyReportedError)
     {
@@ -145,4 +195,7 @@ void Logger::_writeErrorToFile(std::string_view errormsg)
     }
 
     errorFile << logDateTime << errormsg;
+
+    if (!m_reportingError)
+        errorFile.flush();
 }
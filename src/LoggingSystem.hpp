@@ -83,7 +83,15 @@ public:
 
 private:
     void _writeErrorToFile(std::string_view errormsg);
+    void _handleWatchdogTimeout(SourcePawn::IPluginContext *ctx);
+    void _handleFunctionError(SourcePawn::IPluginContext *ctx,
+                              SourcePawn::IPluginFunction *func);
     bool m_alreadyReportedError;
+
+    /* error log kept open between writes */
+    std::ofstream m_errorFile;
+    std::string m_errorFileName;
+    bool m_reportingError = false;
 };
 
 #ifdef SP_CLANG
@@ -266,13 +266,105 @@ static cell_t MenuDisplay(SourcePawn::IPluginContext *ctx,
         return 0;
     }
 
-    std::shared_ptr<Player> pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_player]);
+    if (params[arg_page] < 0)
+    {
+        ctx->ReportError("Invalid page (%d)!", params[arg_page]);
+        return 0;
+    }
+
+    Player *pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_player]);
 
     menuManager->displayMenu(pMenu, pPlayer, params[arg_page], params[arg_time]);
 
     return 1;
 }
 
+// native void DisplayToSet(PlayerFlags include, PlayerFlags exclude = PlayerFlags_None, int team = -1, int page = 0, int time = -1);
+static cell_t MenuDisplayToSet(SourcePawn::IPluginContext *ctx,
+                               const cell_t *params)
+{
+    enum { arg_index = 1, arg_include, arg_exclude, arg_team, arg_page, arg_time };
+
+    cell_t menuId = params[arg_index];
+    if (menuId  < 0)
+    {
+        ctx->ReportError("Invalid menu index!");
+        return 0;
+    }
+
+    const std::unique_ptr<MenuMngr> &menuManager = gSPGlobal->getMenuManagerCore();
+    std::shared_ptr<Menu> pMenu = menuManager->findMenuCore(menuId);
+
+    if(!pMenu)
+    {
+        ctx->ReportError("Menu(%d) not found!", menuId);
+        return 0;
+    }
+
+    // Menu which isn't global is destroyed by the first selection, closing it for everyone else
+    if (pMenu->getStyle() == MenuStyle::Item && !pMenu->getGlobal())
+    {
+        ctx->ReportError("Menu(%d) has to be global to be shown to multiple players!", menuId);
+        return 0;
+    }
+
+    if (params[arg_page] < 0)
+    {
+        ctx->ReportError("Invalid page (%d)!", params[arg_page]);
+        return 0;
+    }
+
+    uint64_t players = gSPGlobal->getPlayerManagerCore()->filterPlayersCore(static_cast<uint32_t>(params[arg_include]),
+                                                                            static_cast<uint32_t>(params[arg_exclude]),
+                                                                            params[arg_team]);
+
+    menuManager->displayMenuToSet(pMenu, players, params[arg_page], params[arg_time]);
+
+    return 1;
+}
+
+// native void DisplayToAll(int page = 0, int time = -1);
+static cell_t MenuDisplayToAll(SourcePawn::IPluginContext *ctx,
+                               const cell_t *params)
+{
+    enum { arg_index = 1, arg_page, arg_time };
+
+    cell_t menuId = params[arg_index];
+    if (menuId  < 0)
+    {
+        ctx->ReportError("Invalid menu index!");
+        return 0;
+    }
+
+    const std::unique_ptr<MenuMngr> &menuManager = gSPGlobal->getMenuManagerCore();
+    std::shared_ptr<Menu> pMenu = menuManager->findMenuCore(menuId);
+
+    if(!pMenu)
+    {
+        ctx->ReportError("Menu(%d) not found!", menuId);
+        return 0;
+    }
+
+    // Menu which isn't global is destroyed by the first selection, closing it for everyone else
+    if (pMenu->getStyle() == MenuStyle::Item && !pMenu->getGlobal())
+    {
+        ctx->ReportError("Menu(%d) has to be global to be shown to multiple players!", menuId);
+        return 0;
+    }
+
+    if (params[arg_page] < 0)
+    {
+        ctx->ReportError("Invalid page (%d)!", params[arg_page]);
+        return 0;
+    }
+
+    uint64_t players = gSPGlobal->getPlayerManagerCore()->getPlayerSet(PlayerMngr::PlayerSet::InGame);
+
+    menuManager->displayMenuToSet(pMenu, players, params[arg_page], params[arg_time]);
+
+    return 1;
+}
+
 // native void Menu.Destroy();
 static cell_t MenuDestroy(SourcePawn::IPluginContext *ctx,
                           const cell_t *params)
@@ -532,12 +624,11 @@ static cell_t MenuClose(SourcePawn::IPluginContext *ctx,
         return 0;
     }
 
-    std::shared_ptr<Player> pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(player);
+    Player *pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(player);
     // TODO: make loop if player == 0
     gSPGlobal->getMenuManagerCore()->closeMenu(pPlayer);
 
-    char menu[] = "\n";
-    UTIL_ShowMenu(pPlayer->getEdict(), 0, 0, menu, strlen(menu));
+    UTIL_ShowMenu(pPlayer->getEdict(), 0, 0, "\n", 1);
 
     return 1;
 }
@@ -718,6 +809,102 @@ static cell_t MenuItemGetData(SourcePawn::IPluginContext *ctx,
     return pItem->getDataCore();
 }
 
+// native void MenuItem.PlayerDependent.set(bool value);
+static cell_t MenuItemPlayerDependentSet(SourcePawn::IPluginContext *ctx,
+                                         const cell_t *params)
+{
+    enum { arg_item = 1, arg_value };
+
+    cell_t packedItem = params[arg_item];
+
+    // MenuExit, Next, Back
+    if(packedItem < 0)
+        return 0;
+
+    cell_t menuId, itemId;
+    UNPACK_ITEM(packedItem, menuId, itemId);
+
+    if (menuId < 0)
+    {
+        ctx->ReportError("Invalid menu index!");
+        return 0;
+    }
+
+    const std::unique_ptr<MenuMngr> &menuManager = gSPGlobal->getMenuManagerCore();
+    std::shared_ptr<Menu> pMenu = menuManager->findMenuCore(menuId);
+
+    if(!pMenu)
+    {
+        ctx->ReportError("Menu(%d) not found!", menuId);
+        return 0;
+    }
+
+    if(pMenu->getStyle() == MenuStyle::Text)
+    {
+        ctx->ReportError("TextStyle menu can't use this native!");
+        return 0;
+    }
+
+    std::shared_ptr<MenuItem> pItem = pMenu->getItemCore(itemId);
+
+    if(!pItem)
+    {
+        ctx->ReportError("Item(%d) not found!", itemId);
+        return 0;
+    }
+
+    pItem->setPlayerDependent(params[arg_value]);
+
+    return 1;
+}
+
+// native bool MenuItem.PlayerDependent.get();
+static cell_t MenuItemPlayerDependentGet(SourcePawn::IPluginContext *ctx,
+                                         const cell_t *params)
+{
+    enum { arg_item = 1 };
+
+    cell_t packedItem = params[arg_item];
+
+    // MenuExit, Next, Back
+    if(packedItem < 0)
+        return 0;
+
+    cell_t menuId, itemId;
+    UNPACK_ITEM(packedItem, menuId, itemId);
+
+    if (menuId < 0)
+    {
+        ctx->ReportError("Invalid menu index!");
+        return 0;
+    }
+
+    const std::unique_ptr<MenuMngr> &menuManager = gSPGlobal->getMenuManagerCore();
+    std::shared_ptr<Menu> pMenu = menuManager->findMenuCore(menuId);
+
+    if(!pMenu)
+    {
+        ctx->ReportError("Menu(%d) not found!", menuId);
+        return 0;
+    }
+
+    if(pMenu->getStyle() == MenuStyle::Text)
+    {
+        ctx->ReportError("TextStyle menu can't use this native!");
+        return 0;
+    }
+
+    std::shared_ptr<MenuItem> pItem = pMenu->getItemCore(itemId);
+
+    if(!pItem)
+    {
+        ctx->ReportError("Item(%d) not found!", itemId);
+        return 0;
+    }
+
+    return pItem->isPlayerDependent();
+}
+
 sp_nativeinfo_t gMenuNatives[] =
 {
     {   "Menu.Menu",                MenuCreate              },
@@ -730,6 +917,8 @@ sp_nativeinfo_t gMenuNatives[] =
     {   "Menu.RemoveAllItems",      MenuRemoveAllItems      },
     {   "Menu.SetProp",             MenuSetProp             },
     {   "Menu.Display",             MenuDisplay             },
+    {   "Menu.DisplayToSet",        MenuDisplayToSet        },
+    {   "Menu.DisplayToAll",        MenuDisplayToAll        },
     {   "Menu.Destroy",             MenuDestroy             },
     {   "Menu.Items.get",           MenuItemsGet            },
     {   "Menu.ItemsPerPage.set",    MenuItemsPerPageSet     },
@@ -744,6 +933,8 @@ sp_nativeinfo_t gMenuNatives[] =
     {   "MenuItem.GetName",         MenuItemGetName         },
     {   "MenuItem.SetData",         MenuItemSetData         },
     {   "MenuItem.GetData",         MenuItemGetData         },
+    {   "MenuItem.PlayerDependent.set", MenuItemPlayerDependentSet },
+    {   "MenuItem.PlayerDependent.get", MenuItemPlayerDependentGet },
 
     {   nullptr,                    nullptr                 }
 };
@@ -20,10 +20,12 @@
 int gmsgShowMenu = 0;
 int gmsgVGUIMenu = 0;
 
-MenuItem::MenuItem(std::string_view name,
+MenuItem::MenuItem(Menu *menu,
+                   std::string_view name,
                    std::variant<SourcePawn::IPluginFunction *, MenuItemCallback> callback,
                    std::variant<cell_t, void *> data,
-                   NavigationType type) : m_name(name),
+                   NavigationType type) : m_menu(menu),
+                                          m_name(name),
                                           m_callback(callback),
                                           m_data(data),
                                           m_type(type)
@@ -55,6 +57,7 @@ NavigationType MenuItem::getNavType() const
 void MenuItem::setCallback(MenuItemCallback func)
 {
     m_callback = func;
+    m_menu->invalidateRender();
 }
 
 // MenuItem
@@ -65,6 +68,7 @@ std::string_view MenuItem::getNameCore() const
 void MenuItem::setNameCore(std::string_view name)
 {
     m_name = name.data();
+    m_menu->invalidateRender();
 }
 
 cell_t MenuItem::getDataCore() const
@@ -77,10 +81,14 @@ void MenuItem::setDataCore(std::variant<cell_t, void *> &&data)
 }
 
 ItemStatus MenuItem::execCallbackCore(Menu *menu,
-                                      std::shared_ptr<MenuItem> item,
-                                      std::shared_ptr<Player> player) const
+                                      Player *player,
+                                      std::size_t statusVersion)
 {
     ItemStatus result = ItemStatus::Enabled;
+
+    // Already evaluated for another player of the same broadcast
+    if(statusVersion && !m_playerDependent && m_statusVersion == statusVersion)
+        return m_status;
     
     try
     {
@@ -89,9 +97,10 @@ ItemStatus MenuItem::execCallbackCore(Menu *menu,
         {
             func->PushCell(static_cast<cell_t>(menu->getId()));
             // item index?
-            func->PushCell(static_cast<cell_t>(PACK_ITEM(menu->getId(), menu->getItemIndex(item))));
+            func->PushCell(static_cast<cell_t>(PACK_ITEM(menu->getId(), menu->getItemIndex(this))));
 
             func->PushCell(static_cast<cell_t>(player->getIndex()));
+            Profiler::Scope profile(func, Profiler::Source::Menu);
             func->Execute(reinterpret_cast<cell_t*>(&result));
         }
     }
@@ -100,13 +109,55 @@ ItemStatus MenuItem::execCallbackCore(Menu *menu,
         auto func = std::get<MenuItemCallback>(m_callback);
         if(func)
         {
-            result = func(menu, item.get(), player.get());
+            result = func(menu, this, player);
         }
     }
 
+    if(statusVersion && !m_playerDependent)
+    {
+        m_statusVersion = statusVersion;
+        m_status = result;
+    }
+
     return result;
 }
 
+std::size_t MenuItem::getPosition() const
+{
+    return m_position;
+}
+
+bool MenuItem::isStatic() const
+{
+    return m_static;
+}
+
+void MenuItem::setPosition(std::size_t position,
+                           bool isStatic)
+{
+    m_position = position;
+    m_static = isStatic;
+}
+
+bool MenuItem::isPlayerDependent() const
+{
+    return m_playerDependent;
+}
+
+void MenuItem::setPlayerDependent(bool dependent)
+{
+    m_playerDependent = dependent;
+    m_menu->invalidateRender();
+}
+
+bool MenuItem::hasCallback() const
+{
+    if (auto *func = std::get_if<SourcePawn::IPluginFunction *>(&m_callback))
+        return *func != nullptr;
+
+    return std::get<MenuItemCallback>(m_callback) != nullptr;
+}
+
 Menu::Menu(std::size_t id,
            std::variant<SourcePawn::IPluginFunction *, MenuItemHandler, MenuTextHandler> &&handler,
            MenuStyle style,
@@ -118,167 +169,386 @@ Menu::Menu(std::size_t id,
                           m_time(-1),
                           m_itemsPerPage(7),
                           m_keys(0),
-                          m_nextItem(std::make_shared<MenuItem>("Next", MenuItemCallback{nullptr}, nullptr, NavigationType::Next)),
-                          m_backItem(std::make_shared<MenuItem>("Back", MenuItemCallback{nullptr}, nullptr, NavigationType::Back)),
-                          m_exitItem(std::make_shared<MenuItem>("Exit", MenuItemCallback{nullptr}, nullptr, NavigationType::Exit)),
+                          m_nextItem(std::make_shared<MenuItem>(this, "Next", MenuItemCallback{nullptr}, nullptr, NavigationType::Next)),
+                          m_backItem(std::make_shared<MenuItem>(this, "Back", MenuItemCallback{nullptr}, nullptr, NavigationType::Back)),
+                          m_exitItem(std::make_shared<MenuItem>(this, "Exit", MenuItemCallback{nullptr}, nullptr, NavigationType::Exit)),
                           m_handler(handler)
-{}
+{
+    _splitNumberFormat();
+}
 
 void Menu::display(IPlayer *player,
                    int page,
                    int time)
 {
-    std::shared_ptr<Player> pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(player->getEdict());
-    displayCore(pPlayer, page, time);
+    Player *pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(player->getEdict());
+
+    // Player's current menu has to follow what they see, keys are resolved against it
+    const std::unique_ptr<MenuMngr> &menuMngr = gSPGlobal->getMenuManagerCore();
+    menuMngr->displayMenu(menuMngr->findMenuCore(m_id), pPlayer, page, time);
 }
 
-void Menu::displayCore(std::shared_ptr<Player> player, int page, int time)
+void Menu::displayToSet(uint64_t players,
+                        int page,
+                        int time)
 {
-    const std::unique_ptr<Utils> &utils = gSPGlobal->getUtilsCore();
-    char buffer[512];
+    // Menu which isn't global is destroyed by the first selection, closing it for everyone else
+    if(m_style == MenuStyle::Item && !m_global)
+        return;
+
+    const std::unique_ptr<MenuMngr> &menuMngr = gSPGlobal->getMenuManagerCore();
+    menuMngr->displayMenuToSet(menuMngr->findMenuCore(m_id), players, page, time);
+}
+
+void Menu::displayToAll(int page,
+                        int time)
+{
+    displayToSet(gSPGlobal->getPlayerManagerCore()->getPlayerSet(PlayerMngr::PlayerSet::InGame), page, time);
+}
+
+void Menu::displayCore(Player *player, int page, int time)
+{
+    m_time = time;
 
     if(m_style == MenuStyle::Item)
     {
-        // format and show menu
-        int keys = 0;
+        const PageCache &render = _getPage(player, page);
 
-        // cache this?
-        // cache to m_text if all items without callback
-        std::stringstream text;
+        // Page could have been clamped to the existing ones
+        player->setMenuPage(page);
+        _showPage(player, render, time);
+    }
+    else
+        _showText(player, time);
+}
 
-        text << m_title << "\n\n";
+void Menu::displayToSetCore(uint64_t players,
+                            int page,
+                            int time)
+{
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
 
-        std::size_t start = page * m_itemsPerPage;
-        std::size_t hidden = 0;
-        
-        if(page)
-        {
-            for(std::size_t j = 0; j < start; j++)
-            {
-                if(m_items[j]->execCallbackCore(this, m_items[j], player) == ItemStatus::Hide)
-                    hidden++;
-            }
-            start += hidden;
+    m_time = time;
 
-            std::size_t statics = 0;
-            for(std::size_t j = 0; j < m_itemsPerPage; j++)
-            {
-                if(m_staticItems[j])
-                    statics++;
-            }
-            start -= statics * page;
+    if(m_style == MenuStyle::Text)
+    {
+        for(unsigned int i = 1; i <= plrMngr->getMaxClients(); i++)
+        {
+            if(players & (uint64_t(1) << i))
+                _showText(plrMngr->getPlayerCore(i), time);
         }
+        return;
+    }
 
-        std::size_t slot = 0;
+    // Page is the same for everyone unless some callback depends on the player
+    bool sharedPage = _isCacheable() || !_hasPlayerCallbacks();
 
-        auto addItem = [&](ItemStatus r, std::size_t s, std::string_view n)
-        {
-            text << utils->strReplacedCore(m_numberFormat, "#num", std::to_string(s + 1 == 10 ? 0 : s + 1));
+    // Player independent callbacks are run once for the whole broadcast
+    m_statusVersion = ++m_lastStatusVersion;
 
-            if(r == ItemStatus::Enabled)
-            {
-                text << " \\w" << n << "\n";
-                keys |= (1 << s);
-            }
-            else
-            {
-                text << " \\d" << n << "\n";
-            }
-        };
+    const PageCache *render = nullptr;
+    Player *renderedFor = nullptr;
+    int requestedPage = page;
+    int renderedPage = page;
+
+    for(unsigned int i = 1; i <= plrMngr->getMaxClients(); i++)
+    {
+        if(!(players & (uint64_t(1) << i)))
+            continue;
 
-        ItemStatus ret = ItemStatus::Enabled;
+        Player *player = plrMngr->getPlayerCore(i);
 
-        std::size_t i = start;
-        while(slot < m_itemsPerPage && i < m_items.size())
+        if(!render || !sharedPage)
         {
-            std::shared_ptr<MenuItem> item = m_staticItems[slot] ? m_staticItems[slot] : m_items[i];
+            renderedPage = requestedPage;
+            render = &_getPage(player, renderedPage);
+            renderedFor = player;
+        }
+        else if(!_isCacheable())
+        {
+            // Continue paging from the same visibility index
+            const Player::MenuState &renderedState = renderedFor->getMenuStateCore();
+            Player::MenuState &state = player->getMenuStateCore();
 
-            ret = item->execCallbackCore(this, item, player);
+            state.pagesMenu = renderedState.pagesMenu;
+            state.pagesVersion = renderedState.pagesVersion;
+            state.pageStarts = renderedState.pageStarts;
+        }
 
-            if(ret == ItemStatus::Hide)
-            {
-                if(!m_staticItems[slot])
-                    ++i;
-                continue;
-            }
+        player->setMenuPage(renderedPage);
+        _showPage(player, *render, time);
+    }
+
+    m_statusVersion = 0;
+}
 
-            addItem(ret, slot, item->getNameCore());
-            m_slots[slot] = item;
+const Menu::PageCache &Menu::_getPage(Player *player,
+                                      int &page)
+{
+    if(page < 0)
+        page = 0;
 
-            if(!m_staticItems[slot])
-                ++i;
-            
-            slot++;
+    if(_isCacheable())
+    {
+        // Every page holds the same number of items, so the last one is known upfront
+        std::size_t dynamicSlots = _getDynamicSlots();
+        std::size_t lastPage = (dynamicSlots && !m_items.empty()) ? (m_items.size() - 1) / dynamicSlots : 0;
+        if(static_cast<std::size_t>(page) > lastPage)
+            page = static_cast<int>(lastPage);
+
+        if(static_cast<std::size_t>(page) >= m_pageCache.size())
+            m_pageCache.resize(page + 1);
+
+        // Same page for every player, render it only after a change
+        PageCache &cache = m_pageCache[page];
+        if(cache.version != m_renderVersion)
+        {
+            _renderPage(player, page, _getPageStart(player, page), cache.text, cache.keys, cache.slots);
+            cache.version = m_renderVersion;
         }
 
-        text << "\n";
+        return cache;
+    }
+
+    // Start is looked up first as it clamps the page
+    std::size_t start = _getPageStart(player, page);
+    std::size_t nextStart = _renderPage(player,
+                                        page,
+                                        start,
+                                        m_scratchPage.text,
+                                        m_scratchPage.keys,
+                                        m_scratchPage.slots);
+
+    // Next page continues where this one ended
+    std::vector<std::size_t> &starts = player->getMenuStateCore().pageStarts;
+    if(starts.size() == static_cast<std::size_t>(page) + 1)
+        starts.push_back(nextStart);
+
+    return m_scratchPage;
+}
+
+void Menu::_showPage(Player *player,
+                     const PageCache &render,
+                     int time)
+{
+    Player::MenuState &state = player->getMenuStateCore();
+    state.slots = render.slots;
+    state.keys = render.keys;
+    state.slotsMenu = m_id;
+    state.slotsVersion = m_itemsVersion;
 
-        while(slot < 7)
+    // Last rendered keys, kept for IMenu::getKeys
+    m_keys = render.keys;
+
+    // TODO: add color autodetect (hl don't show colors)
+    // TODO: color tags, remove if game mode unsupport it
+
+    //show
+    UTIL_ShowMenu(player->getEdict(), render.keys, time, render.text.data(), render.text.size());
+}
+
+void Menu::_showText(Player *player,
+                     int time)
+{
+    Player::MenuState &state = player->getMenuStateCore();
+    state.slots = {};
+    state.keys = m_keys;
+    state.slotsMenu = m_id;
+    state.slotsVersion = m_itemsVersion;
+
+    //show
+    UTIL_ShowMenu(player->getEdict(), m_keys, time, m_text.data(), m_text.size());
+}
+
+std::size_t Menu::_renderPage(Player *player,
+                              int page,
+                              std::size_t start,
+                              std::string &text,
+                              int &keys,
+                              std::array<MenuItem *, 10> &slots)
+{
+    keys = 0;
+
+    text.clear();
+    text.append(m_title).append("\n\n");
+
+    std::size_t slot = 0;
+
+    auto addItem = [&](ItemStatus r, std::size_t s, std::string_view n)
+    {
+        // Text keeps its capacity between renders, so appending doesn't allocate
+        for(std::size_t part = 0; part < m_numberFormatParts.size(); part++)
         {
-            // check for static
-            if(m_staticItems[slot])
-            {
-                std::shared_ptr<MenuItem> item = m_staticItems[slot];
-                ret = item->execCallbackCore(this, item, player);
-
-                if(ret != ItemStatus::Hide)
-                {
-                    addItem(ret, slot, item->getNameCore());
-                    m_slots[slot] = item;
-                }
-            }
-            else
-            {
-                text << "\n";
-            }
+            if(part)
+                text.push_back(static_cast<char>('0' + (s + 1) % 10));
 
-            slot++;
+            text.append(m_numberFormatParts[part]);
         }
 
-        // TODO: add custom names for navigation items
-
-        if(m_items.size() - hidden > i)
+        if(r == ItemStatus::Enabled)
         {
-            addItem(ItemStatus::Enabled, slot, m_nextItem->getNameCore());
-            m_slots[slot++] = m_nextItem;
+            text.append(" \\w").append(n).append("\n");
+            keys |= (1 << s);
         }
         else
         {
-            slot++;
-            text << "\n";
+            text.append(" \\d").append(n).append("\n");
+        }
+    };
+
+    ItemStatus ret = ItemStatus::Enabled;
+
+    std::size_t i = start;
+    while(slot < m_itemsPerPage && i < m_items.size())
+    {
+        bool isStatic = static_cast<bool>(m_staticItems[slot]);
+        const std::shared_ptr<MenuItem> &item = isStatic ? m_staticItems[slot] : m_items[i];
+
+        ret = item->execCallbackCore(this, player, m_statusVersion);
+
+        if(!isStatic)
+            ++i;
+
+        if(ret == ItemStatus::Hide)
+        {
+            // Hidden static item leaves its slot empty
+            if(isStatic)
+                slot++;
+            continue;
         }
 
-        if(page)
+        addItem(ret, slot, item->getNameCore());
+        slots[slot] = item.get();
+
+        slot++;
+    }
+
+    text.append("\n");
+
+    while(slot < 7)
+    {
+        // check for static
+        if(m_staticItems[slot])
         {
-            addItem(ItemStatus::Enabled, slot, m_backItem->getNameCore());
-            m_slots[slot++] = m_backItem;
+            const std::shared_ptr<MenuItem> &item = m_staticItems[slot];
+            ret = item->execCallbackCore(this, player, m_statusVersion);
+
+            if(ret != ItemStatus::Hide)
+            {
+                addItem(ret, slot, item->getNameCore());
+                slots[slot] = item.get();
+            }
         }
         else
         {
-            slot++;
-            text << "\n";
+            text.append("\n");
         }
 
-        addItem(ItemStatus::Enabled, slot, m_exitItem->getNameCore());
-        m_slots[slot] = m_exitItem;
+        slot++;
+    }
 
-        // TODO: add color autodetect (hl don't show colors)
-        // TODO: color tags, remove if game mode unsupport it
+    // TODO: add custom names for navigation items
 
-        utils->strCopyCore(buffer, sizeof(buffer), text.str());
+    // Next page starts at the first visible item, there is none if the rest is hidden
+    std::size_t nextStart = _skipHidden(player, i);
 
-        m_keys = keys;
+    if(nextStart < m_items.size())
+    {
+        addItem(ItemStatus::Enabled, slot, m_nextItem->getNameCore());
+        slots[slot++] = m_nextItem.get();
     }
     else
     {
-        // text style
-        utils->strCopyCore(buffer, sizeof(buffer), m_text);
+        slot++;
+        text.append("\n");
     }
 
-    m_time = time;
+    if(page)
+    {
+        addItem(ItemStatus::Enabled, slot, m_backItem->getNameCore());
+        slots[slot++] = m_backItem.get();
+    }
+    else
+    {
+        slot++;
+        text.append("\n");
+    }
 
-    //show
-    UTIL_ShowMenu(player->getEdict(), m_keys, time, buffer, strlen(buffer));
+    addItem(ItemStatus::Enabled, slot, m_exitItem->getNameCore());
+    slots[slot] = m_exitItem.get();
+
+    return nextStart;
+}
+
+std::size_t Menu::_getPageStart(Player *player,
+                                int &page)
+{
+    // Without callbacks nothing is hidden and every page holds the same number of items
+    if(_isCacheable())
+        return page * _getDynamicSlots();
+
+    Player::MenuState &state = player->getMenuStateCore();
+
+    // New display session, visibility of items is evaluated again
+    if(state.pagesMenu != this || state.pagesVersion != m_itemsVersion)
+    {
+        state.pagesMenu = this;
+        state.pagesVersion = m_itemsVersion;
+        state.pageStarts.assign(1, _skipHidden(player, 0));
+    }
+
+    // Pages which haven't been visited yet, only when jumping forward
+    while(state.pageStarts.size() <= static_cast<std::size_t>(page))
+    {
+        std::size_t nextStart = _skipHidden(player, _skipPage(player, state.pageStarts.back()));
+
+        // No visible item is left, stay on the last page
+        if(nextStart >= m_items.size())
+        {
+            page = static_cast<int>(state.pageStarts.size() - 1);
+            break;
+        }
+
+        state.pageStarts.push_back(nextStart);
+    }
+
+    return state.pageStarts[page];
+}
+
+std::size_t Menu::_skipPage(Player *player,
+                            std::size_t start)
+{
+    std::size_t dynamicSlots = _getDynamicSlots();
+    std::size_t visible = 0;
+
+    while(visible < dynamicSlots && start < m_items.size())
+    {
+        if(m_items[start++]->execCallbackCore(this, player, m_statusVersion) != ItemStatus::Hide)
+            visible++;
+    }
+
+    return start;
+}
+
+std::size_t Menu::_skipHidden(Player *player,
+                              std::size_t position)
+{
+    while(position < m_items.size() && m_items[position]->execCallbackCore(this, player, m_statusVersion) == ItemStatus::Hide)
+        position++;
+
+    return position;
+}
+
+std::size_t Menu::_getDynamicSlots() const
+{
+    std::size_t statics = 0;
+    for(std::size_t j = 0; j < m_itemsPerPage; j++)
+    {
+        if(m_staticItems[j])
+            statics++;
+    }
+
+    return m_itemsPerPage - statics;
 }
 
 bool Menu::getGlobal() const
@@ -312,10 +582,12 @@ void Menu::setTitle(const char *text)
 void Menu::setTitleCore(std::string_view text)
 {
     m_title = text;
+    invalidateRender();
 }
 void Menu::setItemsPerPage(std::size_t value)
 {
     m_itemsPerPage = min(value, static_cast<std::size_t>(10));
+    _itemsChanged();
 }
 std::size_t Menu::getItemsPerPage() const
 {
@@ -325,6 +597,24 @@ std::size_t Menu::getItemsPerPage() const
 void Menu::setNumberFormat(std::string_view format)
 {
     m_numberFormat = format;
+    _splitNumberFormat();
+    invalidateRender();
+}
+
+void Menu::_splitNumberFormat()
+{
+    static constexpr std::string_view numTag = "#num";
+
+    m_numberFormatParts.clear();
+
+    std::size_t start = 0, pos;
+    while((pos = m_numberFormat.find(numTag, start)) != std::string::npos)
+    {
+        m_numberFormatParts.emplace_back(m_numberFormat, start, pos - start);
+        start = pos + numTag.size();
+    }
+
+    m_numberFormatParts.emplace_back(m_numberFormat, start);
 }
 
 int Menu::getTime() const
@@ -337,9 +627,16 @@ int Menu::getKeys() const
     return m_keys;
 }
 
-std::shared_ptr<MenuItem> Menu::keyToItem(int key) const
+MenuItem *Menu::keyToItem(Player *player,
+                          int key) const
 {
-    return m_slots[key].lock();
+    const Player::MenuState &state = player->getMenuStateCore();
+
+    // Other menu has been shown since or items have changed, slots may point to removed ones
+    if (state.slotsMenu != m_id || state.slotsVersion != m_itemsVersion)
+        return nullptr;
+
+    return state.slots[key];
 }
 
 void Menu::appendItem(const char *name,
@@ -393,7 +690,8 @@ bool Menu::setStaticItemCore(std::size_t position,
     if(position >= m_itemsPerPage)
         return false;
     
-    m_staticItems[position] = std::make_shared<MenuItem>(name.data(), std::move(callback), std::move(data), NavigationType::None);
+    m_staticItems[position] = std::make_shared<MenuItem>(this, name.data(), std::move(callback), std::move(data), NavigationType::None);
+    _itemsChanged();
 
     return true;
 }
@@ -404,12 +702,14 @@ bool Menu::removeItem(std::size_t position)
         return false;
     
     m_items.erase(m_items.begin() + position);
+    _itemsChanged();
 
     return true;
 }
 void Menu::removeAllItems()
 {
     m_items.clear();
+    _itemsChanged();
 }
 
 std::size_t Menu::getItems() const
@@ -430,22 +730,19 @@ std::shared_ptr<MenuItem> Menu::getItemCore(std::size_t position) const
     
     return nullptr;
 }
-int Menu::getItemIndex(std::shared_ptr<MenuItem> item) const
+int Menu::getItemIndex(const MenuItem *item) const
 {
-    for(std::size_t i = 0; i < MAX_STATIC_ITEMS; i++)
-    {
-        if(m_staticItems[i] == item)
-            return m_items.size() + i;
-    }
-    for(std::size_t i = 0; i < m_items.size(); i++)
-    {
-        if(m_items[i] == item)
-            return i;
-    }
-    return -1;
+    if(item->getNavType() != NavigationType::None)
+        return -1;
+
+    // Static items are indexed after regular ones
+    if(item->isStatic())
+        return m_items.size() + item->getPosition();
+
+    return item->getPosition();
 }
 
-void Menu::execTextHandler(std::shared_ptr<Player> player,
+void Menu::execTextHandler(Player *player,
                            int key)
 {
     try
@@ -456,18 +753,20 @@ void Menu::execTextHandler(std::shared_ptr<Player> player,
             func->PushCell(static_cast<cell_t>(m_id));
             func->PushCell(static_cast<cell_t>(key));
             func->PushCell(static_cast<cell_t>(player->getIndex()));
+
+            Profiler::Scope profile(func, Profiler::Source::Menu);
             func->Execute(nullptr);
         }
     }
     catch (const std::bad_variant_access &e [[maybe_unused]])
     {
         auto func = std::get<MenuTextHandler>(m_handler);
-        func(this, key, player.get());
+        func(this, key, player);
     }
 }
 
-void Menu::execItemHandler(std::shared_ptr<Player> player,
-                           std::shared_ptr<MenuItem> item)
+void Menu::execItemHandler(Player *player,
+                           MenuItem *item)
 {
     try
     {
@@ -486,19 +785,21 @@ void Menu::execItemHandler(std::shared_ptr<Player> player,
             }
 
             func->PushCell(static_cast<cell_t>(player->getIndex()));
+
+            Profiler::Scope profile(func, Profiler::Source::Menu);
             func->Execute(nullptr);
         }
     }
     catch (const std::bad_variant_access &e [[maybe_unused]])
     {
         auto func = std::get<MenuItemHandler>(m_handler);
-        func(this, item.get(), player.get());
+        func(this, item, player);
     }
 }
 
-void Menu::execExitHandler(std::shared_ptr<Player> player)
+void Menu::execExitHandler(Player *player)
 {
-    execItemHandler(player, m_exitItem);
+    execItemHandler(player, m_exitItem.get());
 }
 
 std::size_t Menu::getId() const
@@ -506,12 +807,68 @@ std::size_t Menu::getId() const
     return m_id;
 }
 
+void Menu::invalidateRender()
+{
+    m_renderVersion++;
+}
+
+void Menu::_itemsChanged()
+{
+    for(std::size_t i = 0; i < m_items.size(); i++)
+        m_items[i]->setPosition(i, false);
+
+    for(std::size_t i = 0; i < MAX_STATIC_ITEMS; i++)
+    {
+        if(m_staticItems[i])
+            m_staticItems[i]->setPosition(i, true);
+    }
+
+    m_itemsVersion++;
+    invalidateRender();
+}
+
+bool Menu::_isCacheable()
+{
+    _updateCallbacksInfo();
+
+    return m_cacheable;
+}
+
+bool Menu::_hasPlayerCallbacks()
+{
+    _updateCallbacksInfo();
+
+    return m_playerCallbacks;
+}
+
+void Menu::_updateCallbacksInfo()
+{
+    if (m_callbacksInfoVersion == m_renderVersion)
+        return;
+
+    auto hasCallback = [](const std::shared_ptr<MenuItem> &item)
+    {
+        return item && item->hasCallback();
+    };
+
+    auto hasPlayerCallback = [](const std::shared_ptr<MenuItem> &item)
+    {
+        return item && item->hasCallback() && item->isPlayerDependent();
+    };
+
+    m_cacheable = std::none_of(m_items.begin(), m_items.end(), hasCallback)
+                    && std::none_of(m_staticItems.begin(), m_staticItems.end(), hasCallback);
+    m_playerCallbacks = std::any_of(m_items.begin(), m_items.end(), hasPlayerCallback)
+                          || std::any_of(m_staticItems.begin(), m_staticItems.end(), hasPlayerCallback);
+    m_callbacksInfoVersion = m_renderVersion;
+}
+
 void Menu::_addItem(int position,
                     std::string_view name,
                     std::variant<SourcePawn::IPluginFunction *, MenuItemCallback> &&callback,
                     std::variant<cell_t, void *> &&data)
 {
-    auto item = std::make_shared<MenuItem>(name.data(), std::move(callback), std::move(data), NavigationType::None);
+    auto item = std::make_shared<MenuItem>(this, name.data(), std::move(callback), std::move(data), NavigationType::None);
     if(position == -1)
     {
         m_items.push_back(item);
@@ -520,6 +877,8 @@ void Menu::_addItem(int position,
     {
         m_items.insert(m_items.begin() + position, item);
     }
+
+    _itemsChanged();
 }
 
 IMenu *MenuMngr::registerMenu(MenuItemHandler handler,
@@ -551,7 +910,7 @@ void MenuMngr::_destroyMenu(IMenu *menu)
 
     for(unsigned int i = 1; i <= plrMngr->getMaxClients(); i++)
     {
-        std::shared_ptr<Player> pPlayer = plrMngr->getPlayerCore(i);
+        Player *pPlayer = plrMngr->getPlayerCore(i);
         std::shared_ptr<Menu> pMenu = pPlayer->getMenu().lock();
 
         if(!pPlayer->isInGame()
@@ -590,22 +949,53 @@ void MenuMngr::clearMenus()
 {
     m_menus.clear();
     m_mid = 0;
+    m_expiryQueue = {};
 }
 
-void MenuMngr::displayMenu(std::shared_ptr<Menu> menu,
-                           std::shared_ptr<Player> player,
+void MenuMngr::displayMenu(const std::shared_ptr<Menu> &menu,
+                           Player *player,
                            int page,
-                           int time)
+                           int time,
+                           bool newSession)
 {
     closeMenu(player);
 
+    // Visibility of items is evaluated again for every display not caused by paging
+    if(newSession)
+        player->getMenuStateCore().pagesMenu = nullptr;
+
     player->setMenu(menu);
-    player->setMenuPage(page);
+    _scheduleExpiry(player, time);
 
     menu->displayCore(player, page, time);
 }
 
-void MenuMngr::closeMenu(std::shared_ptr<Player> player)
+void MenuMngr::displayMenuToSet(const std::shared_ptr<Menu> &menu,
+                                uint64_t players,
+                                int page,
+                                int time)
+{
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
+
+    players &= plrMngr->getPlayerSet(PlayerMngr::PlayerSet::InGame);
+
+    for(unsigned int i = 1; i <= plrMngr->getMaxClients(); i++)
+    {
+        if(!(players & (uint64_t(1) << i)))
+            continue;
+
+        Player *player = plrMngr->getPlayerCore(i);
+        closeMenu(player);
+
+        player->getMenuStateCore().pagesMenu = nullptr;
+        player->setMenu(menu);
+        _scheduleExpiry(player, time);
+    }
+
+    menu->displayToSetCore(players, page, time);
+}
+
+void MenuMngr::closeMenu(Player *player)
 {
     std::shared_ptr<Menu> pMenu = player->getMenu().lock();
 
@@ -622,29 +1012,38 @@ META_RES MenuMngr::ClientCommand(edict_t *pEntity)
 {
     int pressedKey = std::stoi(CMD_ARGV(1), nullptr, 0) - 1;
 
-    std::shared_ptr<Player> pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(pEntity);
+    Player *pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(pEntity);
     std::shared_ptr<Menu> pMenu = pPlayer->getMenu().lock();
 
     if(!pMenu)
         return MRES_IGNORED;
     
-    if(pMenu->getKeys() & (1 << pressedKey))
+    if(pPlayer->getMenuStateCore().keys & (1 << pressedKey))
     {
         pPlayer->setMenu(nullptr);
 
         if(pMenu->getStyle() == MenuStyle::Item)
         {
-            std::shared_ptr<MenuItem> item = pMenu->keyToItem(pressedKey);
+            MenuItem *item = pMenu->keyToItem(pPlayer, pressedKey);
 
+            // Menu has changed under the player, show them the current page instead
+            if(!item)
+            {
+                displayMenu(pMenu, pPlayer, pPlayer->getMenuPage(), pMenu->getTime());
+                return MRES_SUPERCEDE;
+            }
+
+            // Handler can remove the item from the menu
+            NavigationType navType = item->getNavType();
             pMenu->execItemHandler(pPlayer, item);
 
-            if(item->getNavType() == NavigationType::Back)
+            if(navType == NavigationType::Back)
             {
-                displayMenu(pMenu, pPlayer, pPlayer->getMenuPage() - 1, pMenu->getTime());
+                displayMenu(pMenu, pPlayer, pPlayer->getMenuPage() - 1, pMenu->getTime(), false);
             }
-            else if(item->getNavType() == NavigationType::Next)
+            else if(navType == NavigationType::Next)
             {
-                displayMenu(pMenu, pPlayer, pPlayer->getMenuPage() + 1, pMenu->getTime());
+                displayMenu(pMenu, pPlayer, pPlayer->getMenuPage() + 1, pMenu->getTime(), false);
             }
             else if(!pMenu->getGlobal())
             {
@@ -664,37 +1063,74 @@ META_RES MenuMngr::ClientCommand(edict_t *pEntity)
 
 void MenuMngr::ClientDisconnected(edict_t *pEntity)
 {
-    std::shared_ptr<Player> pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(pEntity);
+    Player *pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(pEntity);
     closeMenu(pPlayer);
 }
 
+void MenuMngr::StartFramePost()
+{
+    // Only the top needs to be checked, it holds the earliest deadline
+    if(!m_expiryQueue.empty() && m_expiryQueue.top().deadline <= gpGlobals->time)
+        _processExpiredMenus();
+}
+
+void MenuMngr::_scheduleExpiry(Player *player,
+                               int time)
+{
+    // Every display makes the previous deadline stale, even if the new one has no timeout
+    std::size_t displayId = ++player->getMenuStateCore().displayId;
+
+    // Client keeps menu without positive time until something replaces it
+    if(time <= 0)
+        return;
+
+    m_expiryQueue.push({ gpGlobals->time + time, player, displayId });
+}
+
+void MenuMngr::_processExpiredMenus()
+{
+    while(!m_expiryQueue.empty() && m_expiryQueue.top().deadline <= gpGlobals->time)
+    {
+        MenuExpiry expiry = m_expiryQueue.top();
+        m_expiryQueue.pop();
+
+        Player *player = expiry.player;
+
+        // Menu has been closed or shown again in the meantime
+        if(player->getMenuStateCore().displayId != expiry.displayId || player->getMenu().expired())
+            continue;
+
+        // Client has already hidden the menu, let the handler know it is gone
+        closeMenu(player);
+    }
+}
+
 // TODO: move to util.cpp or same
-/* warning - don't pass here const string */
-void UTIL_ShowMenu(edict_t* pEdict, int slots, int time, char *menu, int mlen)
+void UTIL_ShowMenu(edict_t* pEdict, int slots, int time, const char *menu, std::size_t mlen)
 {
-    char *n = menu;
-    char c = 0;
-    int a;
+    // Longest text of a single message, rest of the menu follows in next ones
+    constexpr std::size_t chunkSize = 175;
+    char chunk[chunkSize + 1];
 
     if (!gmsgShowMenu)
         return; // some games don't support ShowMenu (Firearms)
 
     do
     {
-        a = mlen;
-        if (a > 175) a = 175;
-        mlen -= a;
-        c = *(n+=a);
-        *n = 0;
-        
+        std::size_t length = std::min(mlen, chunkSize);
+        std::memcpy(chunk, menu, length);
+        chunk[length] = '\0';
+
+        menu += length;
+        mlen -= length;
+
+        // Client keeps collecting text until the message without the flag
         MESSAGE_BEGIN(MSG_ONE, gmsgShowMenu, nullptr, pEdict);
         WRITE_SHORT(slots);
         WRITE_CHAR(time);
-        WRITE_BYTE(c ? true : false);
-        WRITE_STRING(menu);
+        WRITE_BYTE(mlen ? true : false);
+        WRITE_STRING(chunk);
         MESSAGE_END();
-        *n = c;
-        menu = n;
     }
-    while (*n);
+    while (mlen);
 }
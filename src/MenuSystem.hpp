@@ -19,7 +19,7 @@
 
 #include "spmod.hpp"
 
-void UTIL_ShowMenu(edict_t* pEdict, int slots, int time, char *menu, int mlen);
+void UTIL_ShowMenu(edict_t* pEdict, int slots, int time, const char *menu, std::size_t mlen);
 
 #define PACK_ITEM(menuid, itemid) (menuid << 16 | itemid)
 #define UNPACK_ITEM(index, menuid, itemid) menuid = index >> 16; itemid = index & 0xFFFF
@@ -32,7 +32,8 @@ class Player;
 class MenuItem: public IMenuItem
 {
 public:
-    MenuItem(std::string_view name,
+    MenuItem(Menu *menu,
+             std::string_view name,
              std::variant<SourcePawn::IPluginFunction *, MenuItemCallback> callback,
              std::variant<cell_t, void *> data,
              NavigationType type);
@@ -49,6 +50,7 @@ public:
     NavigationType getNavType() const override;
 
     void setCallback(MenuItemCallback func) override;
+    void setPlayerDependent(bool dependent) override;
     
     // MenuItem
     std::string_view getNameCore() const;
@@ -58,14 +60,35 @@ public:
     void setDataCore(std::variant<cell_t, void *> &&data);
 
     ItemStatus execCallbackCore(Menu *menu,
-                                std::shared_ptr<MenuItem> item,
-                                std::shared_ptr<Player> player) const;
+                                Player *player,
+                                std::size_t statusVersion = 0);
+
+    bool hasCallback() const;
+    bool isPlayerDependent() const;
+
+    std::size_t getPosition() const;
+    bool isStatic() const;
+    void setPosition(std::size_t position,
+                     bool isStatic);
 
 private:
+    /* menu which owns the item, notified about changes of rendered data */
+    Menu *m_menu;
     std::string m_name;
     std::variant<SourcePawn::IPluginFunction *, MenuItemCallback> m_callback;
     std::variant<cell_t, void *> m_data;
     NavigationType m_type;
+
+    /* position in items or static items of the menu, kept up to date by the menu */
+    std::size_t m_position = 0;
+    bool m_static = false;
+
+    /* status returned by callback can differ between players */
+    bool m_playerDependent = true;
+
+    /* status of player independent callback shared by a single broadcast */
+    std::size_t m_statusVersion = 0;
+    ItemStatus m_status = ItemStatus::Enabled;
 };
 
 class Menu: public IMenu
@@ -82,6 +105,11 @@ public:
     void display(IPlayer *player,
                  int page,
                  int time) override;
+    void displayToSet(uint64_t players,
+                      int page,
+                      int time) override;
+    void displayToAll(int page,
+                      int time) override;
 
     bool getGlobal() const override;
     MenuStyle getStyle() const override;
@@ -121,11 +149,15 @@ public:
     std::size_t getItems() const override;
 
     // Menu
-    void displayCore(std::shared_ptr<Player> player,
+    void displayCore(Player *player,
                      int page,
                      int time);
-    
-    std::shared_ptr<MenuItem> keyToItem(int key) const;
+    void displayToSetCore(uint64_t players,
+                          int page,
+                          int time);
+
+    MenuItem *keyToItem(Player *player,
+                        int key) const;
 
     void setTextCore(std::string_view text);
 
@@ -144,20 +176,61 @@ public:
                            std::variant<cell_t, void *> &&data);
     
     std::shared_ptr<MenuItem> getItemCore(std::size_t position) const;
-    int getItemIndex(std::shared_ptr<MenuItem> menu) const;
+    int getItemIndex(const MenuItem *item) const;
 
     void setNumberFormat(std::string_view format);
 
-    void execTextHandler(std::shared_ptr<Player> player,
+    void execTextHandler(Player *player,
                          int key);
     
-    void execItemHandler(std::shared_ptr<Player> player,
-                         std::shared_ptr<MenuItem> item);
+    void execItemHandler(Player *player,
+                         MenuItem *item);
     
-    void execExitHandler(std::shared_ptr<Player> player);
+    void execExitHandler(Player *player);
 
     std::size_t getId() const;
+
+    /* drops pre-rendered pages, called by every mutation of rendered data */
+    void invalidateRender();
 private:
+    /* rendered page, kept for menus without item callbacks */
+    struct PageCache
+    {
+        /* render version the page has been rendered for */
+        std::size_t version = 0;
+
+        std::string text;
+        int keys = 0;
+        std::array<MenuItem *, 10> slots = {};
+    };
+
+    std::size_t _renderPage(Player *player,
+                            int page,
+                            std::size_t start,
+                            std::string &text,
+                            int &keys,
+                            std::array<MenuItem *, 10> &slots);
+    std::size_t _getPageStart(Player *player,
+                              int &page);
+    std::size_t _skipPage(Player *player,
+                          std::size_t start);
+    std::size_t _skipHidden(Player *player,
+                            std::size_t position);
+    std::size_t _getDynamicSlots() const;
+    /* page is clamped to the existing ones */
+    const PageCache &_getPage(Player *player,
+                              int &page);
+    void _showPage(Player *player,
+                   const PageCache &render,
+                   int time);
+    void _showText(Player *player,
+                   int time);
+    void _splitNumberFormat();
+    bool _isCacheable();
+    bool _hasPlayerCallbacks();
+    void _updateCallbacksInfo();
+    void _itemsChanged();
+
     void _addItem(int position,
                   std::string_view name,
                   std::variant<SourcePawn::IPluginFunction *, MenuItemCallback> &&callback,
@@ -169,11 +242,35 @@ private:
     std::string m_text;
     std::string m_title;
     std::string m_numberFormat;
+
+    /* number format split by #num, so numbers are rendered without replacing */
+    std::vector<std::string> m_numberFormatParts;
     int m_time;
     std::size_t m_itemsPerPage;
     int m_keys;
 
-    std::array<std::weak_ptr<MenuItem>, 10> m_slots;
+    /* bumped on every change of rendered data and every change of items */
+    std::size_t m_renderVersion = 1;
+    std::size_t m_itemsVersion = 1;
+
+    /* no item has a callback, so pages look the same for every player */
+    bool m_cacheable = false;
+
+    /* some item has a callback declared as player dependent */
+    bool m_playerCallbacks = false;
+
+    /* render version the callbacks info has been gathered for */
+    std::size_t m_callbacksInfoVersion = 0;
+
+    /* pages by their number */
+    std::vector<PageCache> m_pageCache;
+
+    /* reused by pages which cannot be cached */
+    PageCache m_scratchPage;
+
+    /* nonzero while broadcasting, player independent callbacks are run once per value */
+    std::size_t m_statusVersion = 0;
+    std::size_t m_lastStatusVersion = 0;
     std::array<std::shared_ptr<MenuItem>, MAX_STATIC_ITEMS> m_staticItems;
 
     std::shared_ptr<MenuItem> m_nextItem;
@@ -210,14 +307,44 @@ public:
     void destroyMenu(std::size_t index);
     void clearMenus();
 
-    void displayMenu(std::shared_ptr<Menu> menu, std::shared_ptr<Player> player, int page, int time);
-    void closeMenu(std::shared_ptr<Player> player);
+    void displayMenu(const std::shared_ptr<Menu> &menu,
+                     Player *player,
+                     int page,
+                     int time,
+                     bool newSession = true);
+    void displayMenuToSet(const std::shared_ptr<Menu> &menu,
+                          uint64_t players,
+                          int page,
+                          int time);
+    void closeMenu(Player *player);
 
     META_RES ClientCommand(edict_t *pEntity);
     void ClientDisconnected(edict_t *pEntity);
+    void StartFramePost();
 private:
+    /* timed menu waiting to be closed */
+    struct MenuExpiry
+    {
+        float deadline;
+        Player *player;
+
+        /* display the deadline belongs to, menu could have been shown again since */
+        std::size_t displayId;
+
+        bool operator>(const MenuExpiry &other) const
+        {
+            return deadline > other.deadline;
+        }
+    };
+
     void _destroyMenu(IMenu *menu);
+    void _scheduleExpiry(Player *player,
+                         int time);
+    void _processExpiredMenus();
 private:
     std::size_t m_mid = 0;
     std::vector<std::shared_ptr<Menu>> m_menus;
+
+    /* menus can have any timeout so deadlines are kept in a heap, earliest on top */
+    std::priority_queue<MenuExpiry, std::vector<MenuExpiry>, std::greater<MenuExpiry>> m_expiryQueue;
 };
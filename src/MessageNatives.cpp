@@ -26,7 +26,7 @@ static cell_t GetUserMsgId(SourcePawn::IPluginContext *ctx,
     char *string;
     ctx->LocalToString(params[arg_msgname], &string);
 
-    return GET_USER_MSG_ID(PLID, string, nullptr);
+    return gSPGlobal->getMessageManagerCore()->getUserMsgIdCore(string);
 }
 
 // int GetUserMsgName(int msgid, char[] str, int len) = 3 params
@@ -35,7 +35,7 @@ static cell_t GetUserMsgName(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_msg = 1, arg_str, arg_len };
 
-    const char* string = GET_USER_MSG_NAME(PLID, params[arg_msg], nullptr);
+    const char* string = gSPGlobal->getMessageManagerCore()->getUserMsgNameCore(params[arg_msg]);
     if (string)
     {
         ctx->StringToLocal(params[arg_str], params[arg_len], string);
@@ -45,6 +45,38 @@ static cell_t GetUserMsgName(SourcePawn::IPluginContext *ctx,
     return 0;
 }
 
+// int GetUserMsgSize(int msgid)
+static cell_t GetUserMsgSize(SourcePawn::IPluginContext *ctx [[maybe_unused]],
+                             const cell_t *params)
+{
+    enum { arg_msg = 1 };
+
+    return gSPGlobal->getMessageManagerCore()->getUserMsgSize(params[arg_msg]);
+}
+
+// int GetUserMsgs(int[] ids, int size)
+static cell_t GetUserMsgs(SourcePawn::IPluginContext *ctx,
+                          const cell_t *params)
+{
+    enum { arg_ids = 1, arg_size };
+
+    std::array<int, MessageMngr::maxMessages> ids;
+    std::size_t num = gSPGlobal->getMessageManagerCore()->getUserMsgs(ids.data(), ids.size());
+
+    cell_t *plIds;
+    ctx->LocalToPhysAddr(params[arg_ids], &plIds);
+
+    std::size_t toCopy = std::min(num, static_cast<std::size_t>(std::max(params[arg_size], 0)));
+    std::copy_n(ids.begin(), toCopy, plIds);
+
+    return static_cast<cell_t>(num);
+}
+
+static bool isValidMessage(int msgid)
+{
+    return gSPGlobal->getMessageManagerCore()->isValidMessage(msgid);
+}
+
 static cell_t MessageBegin_(SourcePawn::IPluginContext *ctx,
                             const cell_t *params, bool useFloat)
 {
@@ -54,8 +86,7 @@ static cell_t MessageBegin_(SourcePawn::IPluginContext *ctx,
     float vecOrigin[3];
     cell_t *cpOrigin;
 
-    if (params[arg_msg_type] < 1 || ((params[arg_msg_type] > 63)		// maximal number of engine messages
-        && !GET_USER_MSG_NAME(PLID, params[2], nullptr)))
+    if (!isValidMessage(params[arg_msg_type]))
     {
         ctx->ReportError("Plugin called message_begin with an invalid message id (%d).", params[arg_msg_type]);
         return 0;
@@ -215,22 +246,669 @@ static cell_t WriteString(SourcePawn::IPluginContext *ctx,
     return 1;
 }
 
+// Resolves receiver and origin the same way MessageBegin does
+static bool getMessageTarget(SourcePawn::IPluginContext *ctx,
+                             int dest,
+                             cell_t player,
+                             cell_t origin,
+                             float (&vecOrigin)[3],
+                             const float *&pOrigin,
+                             edict_t *&edict)
+{
+    pOrigin = nullptr;
+    edict = nullptr;
+
+    switch (dest)
+    {
+    case MSG_PVS: case MSG_PAS:
+    case MSG_PVS_R: case MSG_PAS_R:
+    {
+        cell_t *cpOrigin;
+        ctx->LocalToPhysAddr(origin, &cpOrigin);
+
+        vecOrigin[0] = sp_ctof(cpOrigin[0]);
+        vecOrigin[1] = sp_ctof(cpOrigin[1]);
+        vecOrigin[2] = sp_ctof(cpOrigin[2]);
+        pOrigin = vecOrigin;
+        break;
+    }
+    case MSG_ONE_UNRELIABLE:
+    case MSG_ONE:
+    {
+        Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(player);
+        if (!plr || !plr->isConnected())
+        {
+            ctx->ReportError("Invalid player (%d)", player);
+            return false;
+        }
+
+        edict = plr->getEdict();
+        break;
+    }
+    }
+
+    return true;
+}
+
+// Values of variadic send natives are converted once, before anything is written
+static constexpr std::size_t maxSendValues = 128;
+using SendValues = std::array<MessageMngr::Param, maxSendValues>;
+
+static bool readSendValues(SourcePawn::IPluginContext *ctx,
+                           const cell_t *params,
+                           std::size_t typesArg,
+                           SendValues &values,
+                           std::size_t &valuesNum)
+{
+    char *types;
+    ctx->LocalToString(params[typesArg], &types);
+
+    valuesNum = std::strlen(types);
+    std::size_t passed = static_cast<std::size_t>(params[0]) - typesArg;
+
+    if (valuesNum != passed)
+    {
+        ctx->ReportError("Number of values (%u) does not match number of types (%u)",
+                         static_cast<unsigned int>(passed),
+                         static_cast<unsigned int>(valuesNum));
+        return false;
+    }
+
+    if (valuesNum > maxSendValues)
+    {
+        ctx->ReportError("Too many values (%u), maximum is %u",
+                         static_cast<unsigned int>(valuesNum),
+                         static_cast<unsigned int>(maxSendValues));
+        return false;
+    }
+
+    for (std::size_t i = 0; i < valuesNum; ++i)
+    {
+        MessageMngr::Param &value = values[i];
+        cell_t addr = params[typesArg + 1 + i];
+
+        if (!MessageMngr::getParamType(types[i], value.type))
+        {
+            ctx->ReportError("Invalid message argument type '%c'", types[i]);
+            return false;
+        }
+
+        // Variadic values are passed by reference
+        if (value.type == MessageMngr::ParamType::String)
+        {
+            char *string;
+            ctx->LocalToString(addr, &string);
+            value.sValue = string;
+        }
+        else
+        {
+            cell_t *cell;
+            ctx->LocalToPhysAddr(addr, &cell);
+            value.iValue = *cell;
+            value.fValue = sp_ctof(*cell);
+        }
+    }
+
+    return true;
+}
+
+// native void SendMessage(int dest, int msgid, int player, const float origin[3], const char[] types, any ...);
+static cell_t SendMessage(SourcePawn::IPluginContext *ctx,
+                          const cell_t *params)
+{
+    enum { arg_dest = 1, arg_msgid, arg_player, arg_origin, arg_types };
+
+    if (!isValidMessage(params[arg_msgid]))
+    {
+        ctx->ReportError("Invalid message id (%d)", params[arg_msgid]);
+        return 0;
+    }
+
+    SendValues values;
+    std::size_t valuesNum;
+    if (!readSendValues(ctx, params, arg_types, values, valuesNum))
+        return 0;
+
+    float vecOrigin[3];
+    const float *pOrigin;
+    edict_t *edict;
+    if (!getMessageTarget(ctx, params[arg_dest], params[arg_player], params[arg_origin], vecOrigin, pOrigin, edict))
+        return 0;
+
+    MessageMngr::sendParams(params[arg_dest], params[arg_msgid], pOrigin, edict, values.data(), valuesNum);
+
+    return 1;
+}
+
+// native int SendMessageToSet(PlayerFlags include, PlayerFlags exclude, int team, bool reliable, int msgid, const char[] types, any ...);
+static cell_t SendMessageToSet(SourcePawn::IPluginContext *ctx,
+                               const cell_t *params)
+{
+    enum { arg_include = 1, arg_exclude, arg_team, arg_reliable, arg_msgid, arg_types };
+
+    if (!isValidMessage(params[arg_msgid]))
+    {
+        ctx->ReportError("Invalid message id (%d)", params[arg_msgid]);
+        return 0;
+    }
+
+    SendValues values;
+    std::size_t valuesNum;
+    if (!readSendValues(ctx, params, arg_types, values, valuesNum))
+        return 0;
+
+    uint64_t players = gSPGlobal->getPlayerManagerCore()->filterPlayersCore(static_cast<uint32_t>(params[arg_include]),
+                                                                            static_cast<uint32_t>(params[arg_exclude]),
+                                                                            params[arg_team]);
+
+    return gSPGlobal->getMessageManagerCore()->sendToSet(players, params[arg_reliable], params[arg_msgid], values.data(), valuesNum);
+}
+
+// native int SendMessageToPlayers(const int[] players, int num, bool reliable, int msgid, const char[] types, any ...);
+static cell_t SendMessageToPlayers(SourcePawn::IPluginContext *ctx,
+                                   const cell_t *params)
+{
+    enum { arg_players = 1, arg_num, arg_reliable, arg_msgid, arg_types };
+
+    if (!isValidMessage(params[arg_msgid]))
+    {
+        ctx->ReportError("Invalid message id (%d)", params[arg_msgid]);
+        return 0;
+    }
+
+    SendValues values;
+    std::size_t valuesNum;
+    if (!readSendValues(ctx, params, arg_types, values, valuesNum))
+        return 0;
+
+    cell_t *indexes;
+    ctx->LocalToPhysAddr(params[arg_players], &indexes);
+
+    // Duplicates collapse into a single bit, so nobody gets the message twice
+    uint64_t players = 0;
+    for (cell_t i = 0; i < params[arg_num]; i++)
+    {
+        if (indexes[i] < 1 || indexes[i] > static_cast<cell_t>(MAX_PLAYERS))
+        {
+            ctx->ReportError("Invalid player index (%d)", indexes[i]);
+            return 0;
+        }
+
+        players |= uint64_t(1) << indexes[i];
+    }
+
+    return gSPGlobal->getMessageManagerCore()->sendToSet(players, params[arg_reliable], params[arg_msgid], values.data(), valuesNum);
+}
+
+// MessageTemplate(int msgid, const char[] types)
+static cell_t TemplateCtor(SourcePawn::IPluginContext *ctx,
+                           const cell_t *params)
+{
+    enum { arg_msgid = 1, arg_types };
+
+    if (!isValidMessage(params[arg_msgid]))
+    {
+        ctx->ReportError("Invalid message id (%d)", params[arg_msgid]);
+        return -1;
+    }
+
+    char *types;
+    ctx->LocalToString(params[arg_types], &types);
+
+    const std::unique_ptr<MessageMngr> &msgMngr = gSPGlobal->getMessageManagerCore();
+    std::size_t id = msgMngr->createTemplateCore(params[arg_msgid], ctx);
+    MessageTemplate *msgTemplate = msgMngr->getTemplateCore(id, ctx);
+
+    for (std::size_t i = 0; types[i]; ++i)
+    {
+        MessageMngr::ParamType type;
+        if (!MessageMngr::getParamType(types[i], type))
+        {
+            msgMngr->destroyTemplateCore(id);
+            ctx->ReportError("Invalid message argument type '%c'", types[i]);
+            return -1;
+        }
+
+        msgTemplate->addParam(type);
+    }
+
+    return static_cast<cell_t>(id);
+}
+
+static MessageTemplate *getTemplateField(SourcePawn::IPluginContext *ctx,
+                                         cell_t id,
+                                         cell_t field)
+{
+    MessageTemplate *msgTemplate = gSPGlobal->getMessageManagerCore()->getTemplateCore(id, ctx);
+    if (!msgTemplate)
+    {
+        ctx->ReportError("Message template not found (%d)", id);
+        return nullptr;
+    }
+
+    if (field < 0 || static_cast<std::size_t>(field) >= msgTemplate->getParamsNum())
+    {
+        ctx->ReportError("Invalid template field (%d)", field);
+        return nullptr;
+    }
+
+    return msgTemplate;
+}
+
+// void MessageTemplate.SetInt(int field, int value)
+static cell_t TemplateSetInt(SourcePawn::IPluginContext *ctx,
+                             const cell_t *params)
+{
+    enum { arg_id = 1, arg_field, arg_value };
+
+    MessageTemplate *msgTemplate = getTemplateField(ctx, params[arg_id], params[arg_field]);
+    if (!msgTemplate)
+        return 0;
+
+    switch (msgTemplate->getParam(params[arg_field]).type)
+    {
+    case MessageMngr::ParamType::String:
+        ctx->ReportError("Template field (%d) is a string", params[arg_field]);
+        return 0;
+    case MessageMngr::ParamType::Angle:
+    case MessageMngr::ParamType::Coord:
+        msgTemplate->setFloat(params[arg_field], static_cast<float>(params[arg_value]));
+        break;
+    default:
+        msgTemplate->setInt(params[arg_field], params[arg_value]);
+        break;
+    }
+
+    return 1;
+}
+
+// void MessageTemplate.SetFloat(int field, float value)
+static cell_t TemplateSetFloat(SourcePawn::IPluginContext *ctx,
+                               const cell_t *params)
+{
+    enum { arg_id = 1, arg_field, arg_value };
+
+    MessageTemplate *msgTemplate = getTemplateField(ctx, params[arg_id], params[arg_field]);
+    if (!msgTemplate)
+        return 0;
+
+    switch (msgTemplate->getParam(params[arg_field]).type)
+    {
+    case MessageMngr::ParamType::String:
+        ctx->ReportError("Template field (%d) is a string", params[arg_field]);
+        return 0;
+    case MessageMngr::ParamType::Angle:
+    case MessageMngr::ParamType::Coord:
+        msgTemplate->setFloat(params[arg_field], sp_ctof(params[arg_value]));
+        break;
+    default:
+        msgTemplate->setInt(params[arg_field], static_cast<int>(sp_ctof(params[arg_value])));
+        break;
+    }
+
+    return 1;
+}
+
+// void MessageTemplate.SetString(int field, const char[] value)
+static cell_t TemplateSetString(SourcePawn::IPluginContext *ctx,
+                                const cell_t *params)
+{
+    enum { arg_id = 1, arg_field, arg_value };
+
+    MessageTemplate *msgTemplate = getTemplateField(ctx, params[arg_id], params[arg_field]);
+    if (!msgTemplate)
+        return 0;
+
+    if (msgTemplate->getParam(params[arg_field]).type != MessageMngr::ParamType::String)
+    {
+        ctx->ReportError("Template field (%d) is not a string", params[arg_field]);
+        return 0;
+    }
+
+    char *value;
+    ctx->LocalToString(params[arg_value], &value);
+    msgTemplate->setString(params[arg_field], value);
+
+    return 1;
+}
+
+// void MessageTemplate.Send(int dest, int player = 0, const float origin[3] = {0.0, 0.0, 0.0})
+static cell_t TemplateSend(SourcePawn::IPluginContext *ctx,
+                           const cell_t *params)
+{
+    enum { arg_id = 1, arg_dest, arg_player, arg_origin };
+
+    MessageTemplate *msgTemplate = gSPGlobal->getMessageManagerCore()->getTemplateCore(params[arg_id], ctx);
+    if (!msgTemplate)
+    {
+        ctx->ReportError("Message template not found (%d)", params[arg_id]);
+        return 0;
+    }
+
+    float vecOrigin[3];
+    const float *pOrigin;
+    edict_t *edict;
+    if (!getMessageTarget(ctx, params[arg_dest], params[arg_player], params[arg_origin], vecOrigin, pOrigin, edict))
+        return 0;
+
+    msgTemplate->send(params[arg_dest], pOrigin, edict);
+
+    return 1;
+}
+
+// int MessageTemplate.SendToSet(PlayerFlags include, PlayerFlags exclude = PlayerFlags_None, int team = -1, bool reliable = true)
+static cell_t TemplateSendToSet(SourcePawn::IPluginContext *ctx,
+                                const cell_t *params)
+{
+    enum { arg_id = 1, arg_include, arg_exclude, arg_team, arg_reliable };
+
+    MessageTemplate *msgTemplate = gSPGlobal->getMessageManagerCore()->getTemplateCore(params[arg_id], ctx);
+    if (!msgTemplate)
+    {
+        ctx->ReportError("Message template not found (%d)", params[arg_id]);
+        return 0;
+    }
+
+    uint64_t players = gSPGlobal->getPlayerManagerCore()->filterPlayersCore(static_cast<uint32_t>(params[arg_include]),
+                                                                            static_cast<uint32_t>(params[arg_exclude]),
+                                                                            params[arg_team]);
+
+    return msgTemplate->sendToSet(players, params[arg_reliable]);
+}
+
+// void MessageTemplate.Destroy()
+static cell_t TemplateDestroy(SourcePawn::IPluginContext *ctx,
+                              const cell_t *params)
+{
+    enum { arg_id = 1 };
+
+    const std::unique_ptr<MessageMngr> &msgMngr = gSPGlobal->getMessageManagerCore();
+    if (!msgMngr->getTemplateCore(params[arg_id], ctx))
+    {
+        ctx->ReportError("Message template not found (%d)", params[arg_id]);
+        return 0;
+    }
+
+    msgMngr->destroyTemplateCore(params[arg_id]);
+
+    return 1;
+}
+
+// bool HookMessage(int msgid, MessageHook callback)
+static cell_t HookMessage(SourcePawn::IPluginContext *ctx,
+                          const cell_t *params)
+{
+    enum { arg_msgid = 1, arg_callback };
+
+    if (!MessageMngr::isValidId(params[arg_msgid]))
+    {
+        ctx->ReportError("Invalid message id (%d)", params[arg_msgid]);
+        return 0;
+    }
+
+    SourcePawn::IPluginFunction *func = ctx->GetFunctionById(params[arg_callback]);
+    if (!func)
+    {
+        ctx->ReportError("Invalid function id (%i)", params[arg_callback]);
+        return 0;
+    }
+
+    Plugin *plugin = gSPGlobal->getPluginManagerCore()->getPluginCore(ctx).get();
+    gSPGlobal->getMessageManagerCore()->addHookCore(params[arg_msgid], func, plugin);
+
+    return 1;
+}
+
+// bool UnhookMessage(int msgid, MessageHook callback)
+static cell_t UnhookMessage(SourcePawn::IPluginContext *ctx,
+                            const cell_t *params)
+{
+    enum { arg_msgid = 1, arg_callback };
+
+    if (!MessageMngr::isValidId(params[arg_msgid]))
+    {
+        ctx->ReportError("Invalid message id (%d)", params[arg_msgid]);
+        return 0;
+    }
+
+    SourcePawn::IPluginFunction *func = ctx->GetFunctionById(params[arg_callback]);
+    if (!func)
+    {
+        ctx->ReportError("Invalid function id (%i)", params[arg_callback]);
+        return 0;
+    }
+
+    return gSPGlobal->getMessageManagerCore()->removeHookCore(params[arg_msgid], func);
+}
+
+static MessageMngr::Param *getHookedParam(SourcePawn::IPluginContext *ctx,
+                                          cell_t arg)
+{
+    MessageMngr::Message *msg = gSPGlobal->getMessageManagerCore()->getHookedMessageCore();
+    if (!msg)
+    {
+        ctx->ReportError("Message arguments can be accessed only in a message hook");
+        return nullptr;
+    }
+
+    if (arg < 0 || static_cast<std::size_t>(arg) >= msg->paramsNum)
+    {
+        ctx->ReportError("Invalid message argument (%d), message has %u arguments", arg, static_cast<unsigned int>(msg->paramsNum));
+        return nullptr;
+    }
+
+    return &msg->params[arg];
+}
+
+static bool isFloatParam(const MessageMngr::Param *param)
+{
+    return param->type == MessageMngr::ParamType::Angle || param->type == MessageMngr::ParamType::Coord;
+}
+
+// int GetMsgArgsNum()
+static cell_t GetMsgArgsNum(SourcePawn::IPluginContext *ctx,
+                            const cell_t *params [[maybe_unused]])
+{
+    MessageMngr::Message *msg = gSPGlobal->getMessageManagerCore()->getHookedMessageCore();
+    if (!msg)
+    {
+        ctx->ReportError("Message arguments can be accessed only in a message hook");
+        return 0;
+    }
+
+    return static_cast<cell_t>(msg->paramsNum);
+}
+
+// MsgArgType GetMsgArgType(int arg)
+static cell_t GetMsgArgType(SourcePawn::IPluginContext *ctx,
+                            const cell_t *params)
+{
+    enum { arg_arg = 1 };
+
+    MessageMngr::Param *param = getHookedParam(ctx, params[arg_arg]);
+    if (!param)
+        return 0;
+
+    return static_cast<cell_t>(param->type);
+}
+
+// int GetMsgArgInt(int arg)
+static cell_t GetMsgArgInt(SourcePawn::IPluginContext *ctx,
+                           const cell_t *params)
+{
+    enum { arg_arg = 1 };
+
+    MessageMngr::Param *param = getHookedParam(ctx, params[arg_arg]);
+    if (!param)
+        return 0;
+
+    if (isFloatParam(param))
+        return static_cast<cell_t>(param->fValue);
+
+    if (param->type == MessageMngr::ParamType::String)
+    {
+        ctx->ReportError("Message argument (%d) is a string", params[arg_arg]);
+        return 0;
+    }
+
+    return param->iValue;
+}
+
+// float GetMsgArgFloat(int arg)
+static cell_t GetMsgArgFloat(SourcePawn::IPluginContext *ctx,
+                             const cell_t *params)
+{
+    enum { arg_arg = 1 };
+
+    MessageMngr::Param *param = getHookedParam(ctx, params[arg_arg]);
+    if (!param)
+        return 0;
+
+    if (param->type == MessageMngr::ParamType::String)
+    {
+        ctx->ReportError("Message argument (%d) is a string", params[arg_arg]);
+        return 0;
+    }
+
+    return sp_ftoc(isFloatParam(param) ? param->fValue : static_cast<float>(param->iValue));
+}
+
+// int GetMsgArgString(int arg, char[] buffer, int size)
+static cell_t GetMsgArgString(SourcePawn::IPluginContext *ctx,
+                              const cell_t *params)
+{
+    enum { arg_arg = 1, arg_buffer, arg_size };
+
+    MessageMngr::Param *param = getHookedParam(ctx, params[arg_arg]);
+    if (!param)
+        return 0;
+
+    if (param->type != MessageMngr::ParamType::String)
+    {
+        ctx->ReportError("Message argument (%d) is not a string", params[arg_arg]);
+        return 0;
+    }
+
+    std::size_t written;
+    ctx->StringToLocalUTF8(params[arg_buffer], params[arg_size], param->sValue, &written);
+
+    return static_cast<cell_t>(written);
+}
+
+// void SetMsgArgInt(int arg, int value)
+static cell_t SetMsgArgInt(SourcePawn::IPluginContext *ctx,
+                           const cell_t *params)
+{
+    enum { arg_arg = 1, arg_value };
+
+    MessageMngr::Param *param = getHookedParam(ctx, params[arg_arg]);
+    if (!param)
+        return 0;
+
+    if (param->type == MessageMngr::ParamType::String)
+    {
+        ctx->ReportError("Message argument (%d) is a string", params[arg_arg]);
+        return 0;
+    }
+
+    if (isFloatParam(param))
+        param->fValue = static_cast<float>(params[arg_value]);
+    else
+        param->iValue = params[arg_value];
+
+    return 1;
+}
+
+// void SetMsgArgFloat(int arg, float value)
+static cell_t SetMsgArgFloat(SourcePawn::IPluginContext *ctx,
+                             const cell_t *params)
+{
+    enum { arg_arg = 1, arg_value };
+
+    MessageMngr::Param *param = getHookedParam(ctx, params[arg_arg]);
+    if (!param)
+        return 0;
+
+    if (param->type == MessageMngr::ParamType::String)
+    {
+        ctx->ReportError("Message argument (%d) is a string", params[arg_arg]);
+        return 0;
+    }
+
+    if (isFloatParam(param))
+        param->fValue = sp_ctof(params[arg_value]);
+    else
+        param->iValue = static_cast<int>(sp_ctof(params[arg_value]));
+
+    return 1;
+}
+
+// void SetMsgArgString(int arg, const char[] value)
+static cell_t SetMsgArgString(SourcePawn::IPluginContext *ctx,
+                              const cell_t *params)
+{
+    enum { arg_arg = 1, arg_value };
+
+    MessageMngr::Param *param = getHookedParam(ctx, params[arg_arg]);
+    if (!param)
+        return 0;
+
+    if (param->type != MessageMngr::ParamType::String)
+    {
+        ctx->ReportError("Message argument (%d) is not a string", params[arg_arg]);
+        return 0;
+    }
+
+    char *value;
+    ctx->LocalToString(params[arg_value], &value);
+
+    if (!gSPGlobal->getMessageManagerCore()->setParamString(params[arg_arg], value))
+    {
+        ctx->ReportError("Not enough space in message for string \"%s\"", value);
+        return 0;
+    }
+
+    return 1;
+}
+
 sp_nativeinfo_t gMessageNatives[] =
 {
-    {   "GetUserMsgId",     GetUserMsgId    },
-    {   "GetUserMsgName",   GetUserMsgName  },
-    {   "MessageBegin",     MessageBegin    },
-    {   "MessageBeginF",    MessageBeginF   },
-    {   "MessageEnd",       MessageEnd      },
-    {   "WriteByte",        WriteByte       },
-    {   "WriteChar",        WriteChar       },
-    {   "WriteShort",       WriteShort      },
-    {   "WriteLong",        WriteLong       },
-    {   "WriteEntity",      WriteEntity     },
-    {   "WriteAngle",       WriteAngle      },
-    {   "WriteAngleF",      WriteAngleF     },
-    {   "WriteCoord",       WriteCoord      },
-    {   "WriteCoordF",      WriteCoordF     },
-    {   "WriteString",      WriteString     },
-    {   nullptr,            nullptr         }
+    {   "GetUserMsgId",                     GetUserMsgId         },
+    {   "GetUserMsgName",                   GetUserMsgName       },
+    {   "GetUserMsgSize",                   GetUserMsgSize       },
+    {   "GetUserMsgs",                      GetUserMsgs          },
+    {   "MessageBegin",                     MessageBegin         },
+    {   "MessageBeginF",                    MessageBeginF        },
+    {   "MessageEnd",                       MessageEnd           },
+    {   "WriteByte",                        WriteByte            },
+    {   "WriteChar",                        WriteChar            },
+    {   "WriteShort",                       WriteShort           },
+    {   "WriteLong",                        WriteLong            },
+    {   "WriteEntity",                      WriteEntity          },
+    {   "WriteAngle",                       WriteAngle           },
+    {   "WriteAngleF",                      WriteAngleF          },
+    {   "WriteCoord",                       WriteCoord           },
+    {   "WriteCoordF",                      WriteCoordF          },
+    {   "WriteString",                      WriteString          },
+    {   "SendMessage",                      SendMessage          },
+    {   "SendMessageToSet",                 SendMessageToSet     },
+    {   "SendMessageToPlayers",             SendMessageToPlayers },
+    {   "MessageTemplate.MessageTemplate",  TemplateCtor         },
+    {   "MessageTemplate.SetInt",           TemplateSetInt       },
+    {   "MessageTemplate.SetFloat",         TemplateSetFloat     },
+    {   "MessageTemplate.SetString",        TemplateSetString    },
+    {   "MessageTemplate.Send",             TemplateSend         },
+    {   "MessageTemplate.SendToSet",        TemplateSendToSet    },
+    {   "MessageTemplate.Destroy",          TemplateDestroy      },
+    {   "HookMessage",                      HookMessage          },
+    {   "UnhookMessage",                    UnhookMessage        },
+    {   "GetMsgArgsNum",                    GetMsgArgsNum        },
+    {   "GetMsgArgType",                    GetMsgArgType        },
+    {   "GetMsgArgInt",                     GetMsgArgInt         },
+    {   "GetMsgArgFloat",                   GetMsgArgFloat       },
+    {   "GetMsgArgString",                  GetMsgArgString      },
+    {   "SetMsgArgInt",                     SetMsgArgInt         },
+    {   "SetMsgArgFloat",                   SetMsgArgFloat       },
+    {   "SetMsgArgString",                  SetMsgArgString      },
+    {   nullptr,                            nullptr              }
 };
@@ -0,0 +1,544 @@
+/*  SPMod - SourcePawn Scripting Engine for Half-Life
+ *  Copyright (C) 2018  SPMod Development Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "spmod.hpp"
+
+void MessageMngr::addHookCore(int msgid,
+                              SourcePawn::IPluginFunction *func,
+                              Plugin *plugin)
+{
+    m_hooks[msgid].push_back({ func, plugin });
+}
+
+bool MessageMngr::removeHookCore(int msgid,
+                                 SourcePawn::IPluginFunction *func)
+{
+    auto &hooks = m_hooks[msgid];
+    auto iter = std::find_if(hooks.begin(), hooks.end(), [func](const Hook &hook)
+    {
+        return hook.func == func;
+    });
+
+    if (iter == hooks.end())
+        return false;
+
+    // Hooks are being walked, erase them once the message is dispatched
+    if (m_state == State::Dispatching)
+    {
+        iter->func = nullptr;
+        m_hooksRemoved = true;
+    }
+    else
+        hooks.erase(iter);
+
+    return true;
+}
+
+void MessageMngr::clearHooks()
+{
+    for (auto &hooks : m_hooks)
+        hooks.clear();
+}
+
+MessageMngr::Message *MessageMngr::getHookedMessageCore()
+{
+    return (m_state == State::Dispatching) ? &m_message : nullptr;
+}
+
+bool MessageMngr::setParamString(std::size_t index,
+                                 std::string_view value)
+{
+    const char *string = _storeString(value);
+    if (!string)
+        return false;
+
+    m_message.params[index].sValue = string;
+    return true;
+}
+
+META_RES MessageMngr::MessageBegin(int dest,
+                                   int msgid,
+                                   const float *origin,
+                                   edict_t *edict)
+{
+    // Messages sent by hooks are not captured again
+    if (m_state != State::None || !isValidId(msgid) || m_hooks[msgid].empty())
+        return MRES_IGNORED;
+
+    m_state = State::Capturing;
+
+    m_message.dest = dest;
+    m_message.id = msgid;
+    m_message.edict = edict;
+    m_message.hasOrigin = (origin != nullptr);
+    if (origin)
+        std::copy_n(origin, 3, m_message.origin.begin());
+
+    m_message.paramsNum = 0;
+    m_message.stringsSize = 0;
+
+    return MRES_SUPERCEDE;
+}
+
+META_RES MessageMngr::WriteInt(ParamType type,
+                               int value)
+{
+    if (m_state != State::Capturing)
+        return MRES_IGNORED;
+
+    if (Param *param = _addParam(type); param)
+        param->iValue = value;
+
+    return MRES_SUPERCEDE;
+}
+
+META_RES MessageMngr::WriteFloat(ParamType type,
+                                 float value)
+{
+    if (m_state != State::Capturing)
+        return MRES_IGNORED;
+
+    if (Param *param = _addParam(type); param)
+        param->fValue = value;
+
+    return MRES_SUPERCEDE;
+}
+
+META_RES MessageMngr::WriteString(const char *value)
+{
+    if (m_state != State::Capturing)
+        return MRES_IGNORED;
+
+    if (Param *param = _addParam(ParamType::String); param)
+    {
+        param->sValue = _storeString(value ? value : "");
+
+        // Strings buffer is full, send what fits
+        if (!param->sValue)
+            param->sValue = "";
+    }
+
+    return MRES_SUPERCEDE;
+}
+
+META_RES MessageMngr::MessageEnd()
+{
+    if (m_state != State::Capturing)
+        return MRES_IGNORED;
+
+    m_state = State::Dispatching;
+    bool blocked = _execHooks();
+    m_state = State::None;
+
+    if (m_hooksRemoved)
+    {
+        auto &hooks = m_hooks[m_message.id];
+        hooks.erase(std::remove_if(hooks.begin(), hooks.end(), [](const Hook &hook)
+        {
+            return !hook.func;
+        }), hooks.end());
+        m_hooksRemoved = false;
+    }
+
+    if (!blocked)
+        _send();
+
+    return MRES_SUPERCEDE;
+}
+
+MessageMngr::Param *MessageMngr::_addParam(ParamType type)
+{
+    if (m_message.paramsNum >= maxParams)
+        return nullptr;
+
+    Param &param = m_message.params[m_message.paramsNum++];
+    param.type = type;
+    param.iValue = 0;
+    param.fValue = 0.0f;
+    param.sValue = nullptr;
+
+    return &param;
+}
+
+const char *MessageMngr::_storeString(std::string_view value)
+{
+    if (m_message.stringsSize + value.length() + 1 > stringsBufferSize)
+        return nullptr;
+
+    char *string = m_message.strings.data() + m_message.stringsSize;
+    std::copy(value.begin(), value.end(), string);
+    string[value.length()] = '\0';
+
+    m_message.stringsSize += value.length() + 1;
+
+    return string;
+}
+
+bool MessageMngr::_execHooks()
+{
+    auto &hooks = m_hooks[m_message.id];
+    cell_t player = m_message.edict ? static_cast<cell_t>(ENTINDEX(m_message.edict)) : 0;
+
+    // Hooks can be added by the callbacks, so vector is walked by index
+    for (std::size_t i = 0; i < hooks.size(); ++i)
+    {
+        SourcePawn::IPluginFunction *func = hooks[i].func;
+
+        // Removed or plugin has been paused
+        if (!func || !func->IsRunnable())
+            continue;
+
+        // Hook keeps throwing errors, skip it until its cooldown passes
+        if (hooks[i].plugin->isFunctionDisabled(func))
+            continue;
+
+        cell_t result = static_cast<cell_t>(IForward::ReturnValue::PluginIgnored);
+        int error;
+
+        func->PushCell(m_message.id);
+        func->PushCell(m_message.dest);
+        func->PushCell(player);
+        {
+            Profiler::Scope profile(func, Profiler::Source::Forward);
+            error = func->Execute(&result);
+        }
+
+        // Failed hook doesn't decide about the message
+        if (error != SP_ERROR_NONE)
+            continue;
+
+        if (result != IForward::ReturnValue::PluginIgnored)
+            return true;
+    }
+
+    return false;
+}
+
+void MessageMngr::_send() const
+{
+    sendParams(m_message.dest,
+               m_message.id,
+               m_message.hasOrigin ? m_message.origin.data() : nullptr,
+               m_message.edict,
+               m_message.params.data(),
+               m_message.paramsNum);
+}
+
+bool MessageMngr::getParamType(char symbol,
+                               ParamType &type)
+{
+    switch (symbol)
+    {
+        case 'b':
+            type = ParamType::Byte;
+            return true;
+        case 'c':
+            type = ParamType::Char;
+            return true;
+        case 's':
+            type = ParamType::Short;
+            return true;
+        case 'l':
+            type = ParamType::Long;
+            return true;
+        case 'a':
+            type = ParamType::Angle;
+            return true;
+        case 'o':
+            type = ParamType::Coord;
+            return true;
+        case 'z':
+            type = ParamType::String;
+            return true;
+        case 'e':
+            type = ParamType::Entity;
+            return true;
+    }
+
+    return false;
+}
+
+void MessageMngr::sendParams(int dest,
+                             int msgid,
+                             const float *origin,
+                             edict_t *edict,
+                             const Param *params,
+                             std::size_t paramsNum)
+{
+    MESSAGE_BEGIN(dest, msgid, origin, edict);
+
+    for (std::size_t i = 0; i < paramsNum; ++i)
+        writeParam(params[i]);
+
+    MESSAGE_END();
+}
+
+void MessageMngr::writeParam(const Param &param)
+{
+    switch (param.type)
+    {
+        case ParamType::Byte:
+            WRITE_BYTE(param.iValue);
+            break;
+        case ParamType::Char:
+            WRITE_CHAR(param.iValue);
+            break;
+        case ParamType::Short:
+            WRITE_SHORT(param.iValue);
+            break;
+        case ParamType::Long:
+            WRITE_LONG(param.iValue);
+            break;
+        case ParamType::Angle:
+            WRITE_ANGLE(param.fValue);
+            break;
+        case ParamType::Coord:
+            WRITE_COORD(param.fValue);
+            break;
+        case ParamType::String:
+            WRITE_STRING(param.sValue);
+            break;
+        case ParamType::Entity:
+            WRITE_ENTITY(param.iValue);
+            break;
+    }
+}
+
+unsigned int MessageMngr::sendToSet(uint64_t players,
+                                    bool reliable,
+                                    int msgid,
+                                    const MsgParam *params,
+                                    std::size_t paramsNum)
+{
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
+    int dest = reliable ? MSG_ONE : MSG_ONE_UNRELIABLE;
+    unsigned int sent = 0;
+
+    players &= plrMngr->getPlayerSet(PlayerMngr::PlayerSet::InGame);
+
+    // Values are already converted, replaying them is just a run of engine writes
+    for (unsigned int i = 1; players && i <= plrMngr->getMaxClients(); i++)
+    {
+        if (!(players & (uint64_t(1) << i)))
+            continue;
+
+        players &= ~(uint64_t(1) << i);
+
+        sendParams(dest, msgid, nullptr, plrMngr->getPlayerCore(i)->getEdict(), params, paramsNum);
+        sent++;
+    }
+
+    return sent;
+}
+
+int MessageMngr::getUserMsgId(const char *name) const
+{
+    return getUserMsgIdCore(name);
+}
+
+const char *MessageMngr::getUserMsgName(int msgid) const
+{
+    return getUserMsgNameCore(msgid);
+}
+
+int MessageMngr::getUserMsgSize(int msgid) const
+{
+    return getUserMsgNameCore(msgid) ? m_userMsgs[msgid].size : -1;
+}
+
+std::size_t MessageMngr::getUserMsgs(int *ids,
+                                     std::size_t size) const
+{
+    _loadUserMsgs();
+
+    std::size_t num = 0;
+    for (std::size_t i = firstUserMsg; i < maxMessages; i++)
+    {
+        if (m_userMsgs[i].name.empty())
+            continue;
+
+        if (num < size)
+            ids[num] = static_cast<int>(i);
+
+        num++;
+    }
+
+    return num;
+}
+
+void MessageMngr::registerUserMsgCore(int msgid,
+                                      std::string_view name,
+                                      int size)
+{
+    if (msgid < firstUserMsg || !isValidId(msgid) || name.empty())
+        return;
+
+    UserMsg &userMsg = m_userMsgs[msgid];
+    userMsg.name = name;
+    userMsg.size = size;
+
+    m_userMsgIds[userMsg.name] = msgid;
+}
+
+int MessageMngr::getUserMsgIdCore(std::string_view name) const
+{
+    _loadUserMsgs();
+
+    auto pair = m_userMsgIds.find(std::string(name));
+
+    return (pair != m_userMsgIds.end()) ? pair->second : 0;
+}
+
+const char *MessageMngr::getUserMsgNameCore(int msgid) const
+{
+    if (msgid < firstUserMsg || !isValidId(msgid))
+        return nullptr;
+
+    _loadUserMsgs();
+
+    const std::string &name = m_userMsgs[msgid].name;
+
+    return name.empty() ? nullptr : name.c_str();
+}
+
+bool MessageMngr::isValidMessage(int msgid) const
+{
+    return (msgid > 0 && msgid < firstUserMsg) || getUserMsgNameCore(msgid);
+}
+
+void MessageMngr::_loadUserMsgs() const
+{
+    if (m_userMsgsLoaded)
+        return;
+
+    m_userMsgsLoaded = true;
+
+    for (std::size_t i = firstUserMsg; i < maxMessages; i++)
+    {
+        if (!m_userMsgs[i].name.empty())
+            continue;
+
+        int size = -1;
+        const char *name = GET_USER_MSG_NAME(PLID, static_cast<int>(i), &size);
+        if (!name)
+            continue;
+
+        m_userMsgs[i].name = name;
+        m_userMsgs[i].size = size;
+        m_userMsgIds[name] = static_cast<int>(i);
+    }
+}
+
+std::size_t MessageMngr::createTemplateCore(int msgid,
+                                            SourcePawn::IPluginContext *owner)
+{
+    auto freeSlot = std::find(m_templates.begin(), m_templates.end(), nullptr);
+    if (freeSlot != m_templates.end())
+    {
+        *freeSlot = std::make_unique<MessageTemplate>(msgid, owner);
+        return static_cast<std::size_t>(freeSlot - m_templates.begin());
+    }
+
+    m_templates.push_back(std::make_unique<MessageTemplate>(msgid, owner));
+    return m_templates.size() - 1;
+}
+
+MessageTemplate *MessageMngr::getTemplateCore(std::size_t id,
+                                              SourcePawn::IPluginContext *owner) const
+{
+    if (id >= m_templates.size() || !m_templates[id])
+        return nullptr;
+
+    // Slots are reused, stale handle of other plugin must not reach the template
+    MessageTemplate *msgTemplate = m_templates[id].get();
+    return (msgTemplate->getOwner() == owner) ? msgTemplate : nullptr;
+}
+
+void MessageMngr::destroyTemplateCore(std::size_t id)
+{
+    if (id < m_templates.size())
+        m_templates[id].reset();
+}
+
+void MessageMngr::clearTemplates()
+{
+    m_templates.clear();
+}
+
+MessageTemplate::MessageTemplate(int msgid,
+                                 SourcePawn::IPluginContext *owner) : m_msgId(msgid),
+                                                                      m_owner(owner)
+{}
+
+SourcePawn::IPluginContext *MessageTemplate::getOwner() const
+{
+    return m_owner;
+}
+
+int MessageTemplate::getMsgId() const
+{
+    return m_msgId;
+}
+
+std::size_t MessageTemplate::getParamsNum() const
+{
+    return m_params.size();
+}
+
+const MessageMngr::Param &MessageTemplate::getParam(std::size_t index) const
+{
+    return m_params[index];
+}
+
+void MessageTemplate::addParam(MessageMngr::ParamType type)
+{
+    m_params.push_back({ type, 0, 0.0f, "" });
+    m_strings.emplace_back();
+}
+
+void MessageTemplate::setInt(std::size_t index,
+                             int value)
+{
+    m_params[index].iValue = value;
+}
+
+void MessageTemplate::setFloat(std::size_t index,
+                               float value)
+{
+    m_params[index].fValue = value;
+}
+
+void MessageTemplate::setString(std::size_t index,
+                                std::string_view value)
+{
+    // Assigning can reallocate the storage
+    m_strings[index].assign(value);
+    m_params[index].sValue = m_strings[index].c_str();
+}
+
+void MessageTemplate::send(int dest,
+                           const float *origin,
+                           edict_t *edict) const
+{
+    MessageMngr::sendParams(dest, m_msgId, origin, edict, m_params.data(), m_params.size());
+}
+
+unsigned int MessageTemplate::sendToSet(uint64_t players,
+                                        bool reliable) const
+{
+    return gSPGlobal->getMessageManagerCore()->sendToSet(players, reliable, m_msgId, m_params.data(), m_params.size());
+}
@@ -0,0 +1,223 @@
+/*  SPMod - SourcePawn Scripting Engine for Half-Life
+ *  Copyright (C) 2018  SPMod Development Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "spmod.hpp"
+
+class MessageTemplate;
+
+class MessageMngr final : public IMessageMngr
+{
+public:
+    /* message id is sent as a byte */
+    static constexpr std::size_t maxMessages = 256;
+
+    /* ids below are engine messages */
+    static constexpr int firstUserMsg = 64;
+
+    /* every param takes at least a byte and engine message is never longer than that */
+    static constexpr std::size_t maxParams = 512;
+    static constexpr std::size_t stringsBufferSize = 2048;
+
+    using ParamType = MsgParamType;
+    using Param = MsgParam;
+
+    /* message captured between MessageBegin and MessageEnd */
+    struct Message
+    {
+        int dest;
+        int id;
+        bool hasOrigin;
+        std::array<float, 3> origin;
+        edict_t *edict;
+
+        /* strings point to the strings buffer */
+        std::array<Param, maxParams> params;
+        std::size_t paramsNum;
+
+        /* strings are copied as game could reuse its buffer before the message ends */
+        std::array<char, stringsBufferSize> strings;
+        std::size_t stringsSize;
+    };
+
+    MessageMngr() = default;
+    ~MessageMngr() = default;
+
+    // IMessageMngr
+    unsigned int sendToSet(uint64_t players,
+                           bool reliable,
+                           int msgid,
+                           const MsgParam *params,
+                           std::size_t paramsNum) override;
+    int getUserMsgId(const char *name) const override;
+    const char *getUserMsgName(int msgid) const override;
+    int getUserMsgSize(int msgid) const override;
+    std::size_t getUserMsgs(int *ids,
+                            std::size_t size) const override;
+
+    // MessageMngr
+    void registerUserMsgCore(int msgid,
+                             std::string_view name,
+                             int size);
+    int getUserMsgIdCore(std::string_view name) const;
+    const char *getUserMsgNameCore(int msgid) const;
+
+    /* engine message or registered user message */
+    bool isValidMessage(int msgid) const;
+
+    void addHookCore(int msgid,
+                     SourcePawn::IPluginFunction *func,
+                     Plugin *plugin);
+    bool removeHookCore(int msgid,
+                        SourcePawn::IPluginFunction *func);
+    void clearHooks();
+
+    /* message being dispatched to hooks, nullptr outside of them */
+    Message *getHookedMessageCore();
+    bool setParamString(std::size_t index,
+                        std::string_view value);
+
+    static bool isValidId(int msgid)
+    {
+        return msgid > 0 && static_cast<std::size_t>(msgid) < maxMessages;
+    }
+
+    /* b - byte, c - char, s - short, l - long, a - angle, o - coord, z - string, e - entity */
+    static bool getParamType(char symbol,
+                             ParamType &type);
+
+    static void sendParams(int dest,
+                           int msgid,
+                           const float *origin,
+                           edict_t *edict,
+                           const Param *params,
+                           std::size_t paramsNum);
+    static void writeParam(const Param &param);
+
+    std::size_t createTemplateCore(int msgid,
+                                   SourcePawn::IPluginContext *owner);
+    /* nullptr if the template belongs to other plugin */
+    MessageTemplate *getTemplateCore(std::size_t id,
+                                     SourcePawn::IPluginContext *owner) const;
+    void destroyTemplateCore(std::size_t id);
+    void clearTemplates();
+
+    META_RES MessageBegin(int dest,
+                          int msgid,
+                          const float *origin,
+                          edict_t *edict);
+    META_RES WriteInt(ParamType type,
+                      int value);
+    META_RES WriteFloat(ParamType type,
+                        float value);
+    META_RES WriteString(const char *value);
+    META_RES MessageEnd();
+
+private:
+    enum class State : uint8_t
+    {
+        None = 0,
+        Capturing,
+        Dispatching
+    };
+
+    /* plugin is kept for the error breaker check, hooks are cleared together with plugins */
+    struct Hook
+    {
+        SourcePawn::IPluginFunction *func;
+        Plugin *plugin;
+    };
+
+    Param *_addParam(ParamType type);
+    const char *_storeString(std::string_view value);
+    bool _execHooks();
+    void _send() const;
+
+    /* user message registered by game */
+    struct UserMsg
+    {
+        std::string name;
+        int size = -1;
+    };
+
+    void _loadUserMsgs() const;
+
+    State m_state = State::None;
+
+    /* both directions of id and name lookup, names of unregistered ids are empty */
+    mutable std::array<UserMsg, maxMessages> m_userMsgs;
+    mutable std::unordered_map<std::string, int> m_userMsgIds;
+
+    /* messages registered before SPMod has been loaded are copied from metamod once */
+    mutable bool m_userMsgsLoaded = false;
+
+    /* preallocated, engine sends a single message at a time */
+    Message m_message = {};
+
+    /* hooks by message id, unhooked message costs a single lookup */
+    std::array<std::vector<Hook>, maxMessages> m_hooks;
+
+    /* hooks removed during dispatch are nulled and erased afterwards */
+    bool m_hooksRemoved = false;
+
+    /* template id is its position, slots of destroyed ones are reused */
+    std::vector<std::unique_ptr<MessageTemplate>> m_templates;
+};
+
+/* message built once and sent many times, only changed fields are patched between sends */
+class MessageTemplate final
+{
+public:
+    MessageTemplate() = delete;
+    MessageTemplate(int msgid,
+                    SourcePawn::IPluginContext *owner);
+    ~MessageTemplate() = default;
+
+    MessageTemplate(const MessageTemplate &other) = delete;
+    MessageTemplate &operator=(const MessageTemplate &other) = delete;
+
+    SourcePawn::IPluginContext *getOwner() const;
+    int getMsgId() const;
+    std::size_t getParamsNum() const;
+    const MessageMngr::Param &getParam(std::size_t index) const;
+
+    void addParam(MessageMngr::ParamType type);
+    void setInt(std::size_t index,
+                int value);
+    void setFloat(std::size_t index,
+                  float value);
+    void setString(std::size_t index,
+                   std::string_view value);
+
+    void send(int dest,
+              const float *origin,
+              edict_t *edict) const;
+    unsigned int sendToSet(uint64_t players,
+                           bool reliable) const;
+
+private:
+    int m_msgId;
+
+    /* plugin which created the template */
+    SourcePawn::IPluginContext *m_owner;
+
+    std::vector<MessageMngr::Param> m_params;
+
+    /* storage of string params, indexed same as params */
+    std::vector<std::string> m_strings;
+};
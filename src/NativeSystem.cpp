@@ -63,6 +63,31 @@ std::string_view Native::getOwnerCore() const
     return m_ownerIdentity;
 }
 
+SPVM_NATIVE_FUNC Native::getTrampoline()
+{
+    if (!m_trampoline)
+    {
+        SourcePawn::ISourcePawnEngine2 *spAPIv2 = gSPGlobal->getSPEnvironment()->APIv2();
+        m_trampoline = spAPIv2->CreateFakeNative(NativeMngr::profilingRouter, this);
+    }
+
+    return m_trampoline;
+}
+
+void Native::destroyTrampoline()
+{
+    if (!m_trampoline)
+        return;
+
+    gSPGlobal->getSPEnvironment()->APIv2()->DestroyFakeNative(m_trampoline);
+    m_trampoline = nullptr;
+}
+
+bool Native::isBoundTo(SPVM_NATIVE_FUNC func) const
+{
+    return func == m_router || (m_trampoline && func == m_trampoline);
+}
+
 void NativeMngr::freeFakeNatives()
 {
     SourcePawn::ISourcePawnEngine2 *spAPIv2 = gSPGlobal->getSPEnvironment()->APIv2();
@@ -75,6 +100,7 @@ void NativeMngr::freeFakeNatives()
             continue;
         }
 
+        pair->second->destroyTrampoline();
         spAPIv2->DestroyFakeNative(pair->second->getRouter());
         pair = m_natives.erase(pair);
     }
@@ -94,7 +120,8 @@ std::shared_ptr<Native> NativeMngr::getNativeCore(std::string_view name) const
 bool NativeMngr::addNatives(IModuleInterface *interface, const sp_nativeinfo_t *nativeslist)
 {
     //TODO: Error reporting?
-    if (interface->getInterfaceVersion() > SPMOD_API_VERSION)
+    // Interfaces are extended in place, modules built against other version would call wrong methods
+    if (interface->getInterfaceVersion() != SPMOD_API_VERSION)
         return false;
 
     const char *moduleName = interface->getName();
@@ -157,7 +184,10 @@ cell_t NativeMngr::fakeNativeRouter(SourcePawn::IPluginContext *ctx,
 
     SourcePawn::IPluginFunction *func = native->getFunc();
     func->PushCell(caller->getId());
-    func->Execute(&result);
+    {
+        Profiler::Scope profile(func, Profiler::Source::Native);
+        func->Execute(&result);
+    }
 
     m_callerPlugin = nullptr;
 
@@ -172,5 +202,61 @@ INative *NativeMngr::getNative(const char *name) const
 void NativeMngr::clearNatives()
 {
     freeFakeNatives();
+
+    for (const auto &pair : m_natives)
+        pair.second->destroyTrampoline();
+
     m_natives.clear();
 }
+
+void NativeMngr::bindNatives(SourcePawn::IPluginRuntime *runtime)
+{
+    uint32_t nativesNum = runtime->GetNativesNum();
+    for (uint32_t index = 0; index < nativesNum; ++index)
+    {
+        const sp_native_t *pluginNative = runtime->GetNative(index);
+
+        std::shared_ptr<Native> native = getNativeCore(pluginNative->name);
+        if (!native)
+            continue;
+
+        // Leave natives bound by someone else
+        if (pluginNative->status == SP_NATIVE_BOUND && !native->isBoundTo(pluginNative->pfn))
+            continue;
+
+        SPVM_NATIVE_FUNC func = m_profiling ? native->getTrampoline() : native->getRouter();
+        runtime->UpdateNativeBinding(index, func, 0, nullptr);
+    }
+}
+
+void NativeMngr::setProfiling(bool enable)
+{
+    if (m_profiling == enable)
+        return;
+
+    m_profiling = enable;
+
+    // Rebind natives of already loaded plugins
+    for (const auto &plugin : gSPGlobal->getPluginManagerCore()->getPluginsList())
+        bindNatives(plugin->getRuntime());
+}
+
+bool NativeMngr::isProfiling() const
+{
+    return m_profiling;
+}
+
+cell_t NativeMngr::profilingRouter(SourcePawn::IPluginContext *ctx,
+                                   const cell_t *params,
+                                   void *data)
+{
+    auto *native = reinterpret_cast<Native *>(data);
+
+    Profiler::clock::time_point start = Profiler::clock::now();
+    cell_t result = native->getRouter()(ctx, params);
+    Profiler::clock::duration time = Profiler::clock::now() - start;
+
+    gSPGlobal->getProfilerCore()->recordNative(native, ctx->GetRuntime(), time);
+
+    return result;
+}
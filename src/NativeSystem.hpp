@@ -43,6 +43,9 @@ public:
     SPVM_NATIVE_FUNC getRouter() const;
     std::string_view getNameCore() const;
     std::string_view getOwnerCore() const;
+    SPVM_NATIVE_FUNC getTrampoline();
+    void destroyTrampoline();
+    bool isBoundTo(SPVM_NATIVE_FUNC func) const;
 
 private:
 
@@ -50,6 +53,9 @@ private:
     std::string m_nativeName;
     SPVM_NATIVE_FUNC m_router;
 
+    /* profiling router bound instead of m_router, created on demand */
+    SPVM_NATIVE_FUNC m_trampoline = nullptr;
+
     // Only valid for fake natives
     SourcePawn::IPluginFunction *m_func; /* Function to execute in plugin */
 };
@@ -79,6 +85,9 @@ public:
                        SourcePawn::IPluginFunction *func);
 
     std::shared_ptr<Native> getNativeCore(std::string_view name) const;
+    void bindNatives(SourcePawn::IPluginRuntime *runtime);
+    void setProfiling(bool enable);
+    bool isProfiling() const;
 
     // For fake natives
     static cell_t fakeNativeRouter(SourcePawn::IPluginContext *ctx,
@@ -88,6 +97,14 @@ public:
     static inline SourcePawn::IPluginContext *m_callerPlugin;
     static inline cell_t m_callerParams[SP_MAX_EXEC_PARAMS + 1];
 
+    // For profiling
+    static cell_t profilingRouter(SourcePawn::IPluginContext *ctx,
+                                  const cell_t *params,
+                                  void *data);
+
 private:
     std::unordered_map<std::string, std::shared_ptr<Native>> m_natives;
+
+    /* plugins are bound to profiling trampolines instead of natives */
+    bool m_profiling = false;
 };
\ No newline at end of file
@@ -25,7 +25,7 @@ static cell_t GetName(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_id = 1, arg_buffer, arg_size };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -45,7 +45,7 @@ static cell_t GetIP(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_id = 1, arg_buffer, arg_size, arg_port };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -74,7 +74,7 @@ static cell_t GetSteamID(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_id = 1, arg_buffer, arg_size };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -94,7 +94,7 @@ static cell_t GetIndex(SourcePawn::IPluginContext *ctx [[maybe_unused]],
 {
     enum { arg_id = 1 };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -111,7 +111,7 @@ static cell_t GetUserID(SourcePawn::IPluginContext *ctx [[maybe_unused]],
 {
     enum { arg_id = 1 };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -128,7 +128,7 @@ static cell_t AliveGet(SourcePawn::IPluginContext *ctx [[maybe_unused]],
 {
     enum { arg_id = 1 };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -145,7 +145,7 @@ static cell_t ConnectedGet(SourcePawn::IPluginContext *ctx [[maybe_unused]],
 {
     enum { arg_id = 1 };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -162,7 +162,7 @@ static cell_t FakeGet(SourcePawn::IPluginContext *ctx [[maybe_unused]],
 {
     enum { arg_id = 1 };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -179,7 +179,7 @@ static cell_t HLTVGet(SourcePawn::IPluginContext *ctx [[maybe_unused]],
 {
     enum { arg_id = 1 };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -196,7 +196,7 @@ static cell_t InGame(SourcePawn::IPluginContext *ctx [[maybe_unused]],
 {
     enum { arg_id = 1 };
 
-    std::shared_ptr<Player> plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
 
     if (!plr)
     {
@@ -207,11 +207,171 @@ static cell_t InGame(SourcePawn::IPluginContext *ctx [[maybe_unused]],
     return plr->isInGame();
 }
 
+// int GetPlayersData(PlayerData field, any[] buffer, int size)
+static cell_t GetPlayersData(SourcePawn::IPluginContext *ctx,
+                             const cell_t *params)
+{
+    using field = PlayerMngr::SnapshotField;
+    enum { arg_field = 1, arg_buffer, arg_size };
+
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
+    const PlayerMngr::PlayersSnapshot &snapshot = plrMngr->getSnapshot();
+
+    const void *column;
+    std::size_t cellsPerPlayer = 1;
+
+    switch (static_cast<field>(params[arg_field]))
+    {
+        case field::Alive:
+            column = snapshot.alive.data();
+            break;
+        case field::Team:
+            column = snapshot.team.data();
+            break;
+        case field::Health:
+            column = snapshot.health.data();
+            break;
+        case field::Flags:
+            column = snapshot.flags.data();
+            break;
+        case field::InGame:
+            column = snapshot.inGame.data();
+            break;
+        case field::Bot:
+            column = snapshot.bot.data();
+            break;
+        case field::Origin:
+            column = snapshot.origin.data();
+            cellsPerPlayer = 3;
+            break;
+        default:
+        {
+            ctx->ReportError("Invalid player data field (%i)", params[arg_field]);
+            return 0;
+        }
+    }
+
+    if (params[arg_size] < 0)
+    {
+        ctx->ReportError("Invalid buffer size (%i)", params[arg_size]);
+        return 0;
+    }
+
+    cell_t *buffer;
+    ctx->LocalToPhysAddr(params[arg_buffer], &buffer);
+
+    // Slot 0 is left for the world so buffer can be indexed by player index
+    std::size_t cellsNum = std::min(static_cast<std::size_t>(params[arg_size]),
+                                    (plrMngr->getMaxClients() + 1) * cellsPerPlayer);
+
+    std::memcpy(buffer, column, cellsNum * sizeof(cell_t));
+
+    return static_cast<cell_t>(cellsNum);
+}
+
+// int GetPlayers(int[] players, int size, PlayerFlags include = PlayerFlags_InGame, PlayerFlags exclude = PlayerFlags_None, int team = -1)
+static cell_t GetPlayers(SourcePawn::IPluginContext *ctx,
+                         const cell_t *params)
+{
+    enum { arg_players = 1, arg_size, arg_include, arg_exclude, arg_team };
+
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
+
+    uint64_t players = plrMngr->filterPlayersCore(static_cast<uint32_t>(params[arg_include]),
+                                                  static_cast<uint32_t>(params[arg_exclude]),
+                                                  params[arg_team]);
+
+    cell_t *buffer;
+    ctx->LocalToPhysAddr(params[arg_players], &buffer);
+
+    cell_t found = 0;
+    unsigned int maxClients = plrMngr->getMaxClients();
+    for (unsigned int i = 1; i <= maxClients && found < params[arg_size]; ++i)
+    {
+        if (players & (uint64_t(1) << i))
+            buffer[found++] = static_cast<cell_t>(i);
+    }
+
+    return found;
+}
+
+// int ResolveTarget(const char[] pattern, int[] players, int size)
+static cell_t ResolveTarget(SourcePawn::IPluginContext *ctx,
+                            const cell_t *params)
+{
+    enum { arg_pattern = 1, arg_players, arg_size };
+
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
+
+    char *pattern;
+    ctx->LocalToString(params[arg_pattern], &pattern);
+
+    uint64_t players = plrMngr->resolveTargetCore(pattern);
+
+    cell_t *buffer;
+    ctx->LocalToPhysAddr(params[arg_players], &buffer);
+
+    cell_t found = 0;
+    unsigned int maxClients = plrMngr->getMaxClients();
+    for (unsigned int i = 1; i <= maxClients && found < params[arg_size]; ++i)
+    {
+        if (players & (uint64_t(1) << i))
+            buffer[found++] = static_cast<cell_t>(i);
+    }
+
+    return found;
+}
+
+// int Player.GetUserInfo(const char[] key, char[] buffer, int size)
+static cell_t GetUserInfo(SourcePawn::IPluginContext *ctx,
+                          const cell_t *params)
+{
+    enum { arg_id = 1, arg_key, arg_buffer, arg_size };
+
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(params[arg_id]);
+
+    if (!plr)
+    {
+        ctx->ReportError("Non player index (%i)", params[arg_id]);
+        return 0;
+    }
+
+    char *key, *buffer;
+    ctx->LocalToString(params[arg_key], &key);
+    ctx->LocalToString(params[arg_buffer], &buffer);
+
+    const char *value = plr->getUserInfoCore().getValue(key);
+
+    return gSPGlobal->getUtilsCore()->strCopyCore(buffer, params[arg_size], value ? value : "");
+}
+
+// void HookUserInfo(const char[] key, UserInfoChanged callback)
+static cell_t HookUserInfo(SourcePawn::IPluginContext *ctx,
+                           const cell_t *params)
+{
+    enum { arg_key = 1, arg_callback };
+
+    char *key;
+    ctx->LocalToString(params[arg_key], &key);
+
+    SourcePawn::IPluginFunction *func = ctx->GetFunctionById(params[arg_callback]);
+    if (!func)
+    {
+        ctx->ReportError("Invalid function id (%i)", params[arg_callback]);
+        return 0;
+    }
+
+    gSPGlobal->getPlayerManagerCore()->addUserInfoHookCore(key, func);
+
+    return 1;
+}
+
 sp_nativeinfo_t gPlayerNatives[] =
 {
     { "Player.GetName",         GetName      },
     { "Player.GetIP",           GetIP        },
     { "Player.GetSteamID",      GetSteamID   },
+    { "Player.GetUserInfo",     GetUserInfo  },
     { "Player.Index.get",       GetIndex     },
     { "Player.UserID.get",      GetUserID    },
     { "Player.Alive.get",       AliveGet     },
@@ -219,5 +379,9 @@ sp_nativeinfo_t gPlayerNatives[] =
     { "Player.Fake.get",        FakeGet      },
     { "Player.HLTV.get",        HLTVGet      },
     { "Player.InGame.get",      InGame       },
+    { "GetPlayersData",         GetPlayersData },
+    { "GetPlayers",             GetPlayers   },
+    { "ResolveTarget",          ResolveTarget },
+    { "HookUserInfo",           HookUserInfo },
     { nullptr,                  nullptr      }
 };
@@ -59,12 +59,17 @@ void Player::setMenu(std::shared_ptr<Menu> menu)
 
 int Player::getMenuPage() const
 {
-    return m_menuPage;
+    return m_menuState.page;
 }
 
 void Player::setMenuPage(int page)
 {
-    m_menuPage = page;
+    m_menuState.page = page;
+}
+
+Player::MenuState &Player::getMenuStateCore()
+{
+    return m_menuState;
 }
 
 void Player::connect(std::string_view name,
@@ -84,6 +89,10 @@ void Player::disconnect()
     m_ip.clear();
     m_name.clear();
     m_steamID.clear();
+
+    // Next client in the slot reports all of its keys as changed
+    m_userInfo[0].clear();
+    m_userInfo[1].clear();
 }
 
 void Player::putInServer()
@@ -96,6 +105,84 @@ void Player::authorize(std::string_view authid)
     m_steamID = authid;
 }
 
+bool Player::isAuthorized() const
+{
+    return !m_steamID.empty();
+}
+
+void Player::updateUserInfo(const char *infobuffer)
+{
+    m_userInfoPos ^= 1;
+    m_userInfo[m_userInfoPos].parse(infobuffer);
+}
+
+const Player::UserInfo &Player::getUserInfoCore() const
+{
+    return m_userInfo[m_userInfoPos];
+}
+
+const Player::UserInfo &Player::getPrevUserInfoCore() const
+{
+    return m_userInfo[m_userInfoPos ^ 1];
+}
+
+const char *Player::getUserInfo(const char *key) const
+{
+    return getUserInfoCore().getValue(key);
+}
+
+void Player::UserInfo::clear()
+{
+    m_keysNum = 0;
+}
+
+const char *Player::UserInfo::getValue(std::string_view key) const
+{
+    for (std::size_t i = 0; i < m_keysNum; ++i)
+    {
+        if (key == m_keys[i])
+            return m_values[i];
+    }
+
+    return nullptr;
+}
+
+void Player::UserInfo::parse(const char *infobuffer)
+{
+    std::size_t length = std::min(std::strlen(infobuffer), bufferSize - 1);
+    std::memcpy(m_buffer.data(), infobuffer, length);
+    m_buffer[length] = '\0';
+    m_keysNum = 0;
+
+    // Buffer has form of \key\value\key\value, separators are replaced by terminators
+    char *pos = m_buffer.data();
+    if (*pos == '\\')
+        pos++;
+
+    while (*pos && m_keysNum < maxKeys)
+    {
+        char *key = pos;
+        char *separator = std::strchr(key, '\\');
+
+        // Key without value
+        if (!separator)
+            break;
+
+        *separator = '\0';
+        char *value = separator + 1;
+
+        m_keys[m_keysNum] = key;
+        m_values[m_keysNum] = value;
+        m_keysNum++;
+
+        pos = std::strchr(value, '\\');
+        if (!pos)
+            break;
+
+        *pos++ = '\0';
+    }
+}
+
 const char *Player::getName() const
 {
     return getNameCore().data();
@@ -153,12 +240,12 @@ bool Player::isInGame() const
 
 IPlayer *PlayerMngr::getPlayer(int index) const
 {
-    return getPlayerCore(index).get();
+    return getPlayerCore(index);
 }
 
 IPlayer *PlayerMngr::getPlayer(edict_t *edict) const
 {
-    return getPlayerCore(edict).get();
+    return getPlayerCore(edict);
 }
 
 unsigned int PlayerMngr::getMaxClients() const
@@ -192,32 +279,21 @@ void PlayerMngr::_initPlayers(edict_t *edictList)
 {
     for (size_t i = 1; i <= m_maxClients; i++)
     {
-        m_players.at(i) = std::make_shared<Player>(edictList + i, i);
+        m_players.at(i) = std::make_unique<Player>(edictList + i, i);
     }
 }
 
-std::shared_ptr<Player> PlayerMngr::getPlayerCore(int index) const
+Player *PlayerMngr::getPlayerCore(int index) const
 {
-    try
-    {
-        return m_players.at(index);
-    }
-    catch (const std::out_of_range &e [[maybe_unused]])
-    {
+    if (index < 1 || static_cast<unsigned int>(index) > m_maxClients)
         return nullptr;
-    }
+
+    return m_players[index].get();
 }
 
-std::shared_ptr<Player> PlayerMngr::getPlayerCore(edict_t *edict) const
+Player *PlayerMngr::getPlayerCore(edict_t *edict) const
 {
-    try
-    {
-        return m_players.at(ENTINDEX(edict));
-    }
-    catch (const std::out_of_range &e [[maybe_unused]])
-    {
-        return nullptr;
-    }
+    return getPlayerCore(ENTINDEX(edict));
 }
 
 void PlayerMngr::_setMaxClients(int maxClients)
@@ -245,64 +321,503 @@ void PlayerMngr::ClientConnectPost(edict_t *pEntity,
                                    const char *pszAddress)
 {
     const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
-    std::shared_ptr<Player> plr = plrMngr->getPlayerCore(pEntity);
+    Player *plr = plrMngr->getPlayerCore(pEntity);
     plr->connect(pszName, pszAddress);
 
+    m_userIdIndex[plr->getUserId()] = plr->getIndex();
+    _setName(plr, pszName);
+
+    _setInSet(PlayerSet::Connected, plr->getIndex(), true);
+    _setInSet(PlayerSet::Bot, plr->getIndex(), plr->isFake());
+    _setInSet(PlayerSet::HLTV, plr->getIndex(), plr->isHLTV());
+
     PlayerMngr::m_playersNum++;
 
     // callback for modules
     for (auto *listener : plrMngr->getListenerList())
     {
-        listener->OnClientConnected(plr.get());
+        listener->OnClientConnected(plr);
     }
 
-    std::string_view authid(GETPLAYERAUTHID(pEntity));
-
-    if (authid.empty() || !authid.compare("STEAM_ID_PENDING"))
-        m_playersToAuth.push_back(plr);
-    else
-        plr->authorize(authid);
+    if (!_tryAuthorize(plr))
+        m_authQueue.push_back({ gpGlobals->time + authCheckInterval, plr, plr->getUserId() });
 }
 
 void PlayerMngr::ClientPutInServerPost(edict_t *pEntity)
 {
-    std::shared_ptr<Player> plr = getPlayerCore(pEntity);
+    Player *plr = getPlayerCore(pEntity);
     plr->putInServer();
+    _setInSet(PlayerSet::InGame, plr->getIndex(), true);
+
+    // Steam usually validates client until they enter the game, do not wait for the queue
+    if (!plr->isAuthorized())
+        _tryAuthorize(plr);
 
     // callback for modules
     for (auto *listener : getListenerList())
     {
-        listener->OnClientPutInServer(plr.get());
+        listener->OnClientPutInServer(plr);
     }
 }
 
+void PlayerMngr::SV_DropClientPost(edict_t *pEntity)
+{
+    unsigned int index = ENTINDEX(pEntity);
+    uint64_t bit = uint64_t(1) << index;
+
+    // Drop only entries which still point to this slot
+    auto removeFromIndex = [index](auto &lookupIndex)
+    {
+        for (auto iter = lookupIndex.begin(); iter != lookupIndex.end(); )
+        {
+            if (iter->second == index)
+                iter = lookupIndex.erase(iter);
+            else
+                ++iter;
+        }
+    };
+
+    removeFromIndex(m_userIdIndex);
+    removeFromIndex(m_steamIdIndex);
+    m_lowerNames[index].clear();
+
+    for (uint64_t &set : m_playerSets)
+        set &= ~bit;
+
+    for (uint64_t &set : m_teamSets)
+        set &= ~bit;
+}
+
+void PlayerMngr::_setInSet(PlayerSet set,
+                           unsigned int index,
+                           bool member)
+{
+    uint64_t bit = uint64_t(1) << index;
+    uint64_t &players = m_playerSets[static_cast<std::size_t>(set)];
+
+    if (member)
+        players |= bit;
+    else
+        players &= ~bit;
+}
+
 void PlayerMngr::ClientUserInfoChangedPost(edict_t *pEntity,
                                            char *infobuffer)
 {
-    std::shared_ptr<Player> plr = getPlayerCore(pEntity);
-    plr->setName(INFOKEY_VALUE(infobuffer, "name"));
+    Player *plr = getPlayerCore(pEntity);
+
+    // Running hooks still read the cached values, apply the change after them
+    if (m_userInfoHooksRunning)
+    {
+        m_pendingUserInfo |= uint64_t(1) << plr->getIndex();
+        return;
+    }
+
+    _updateUserInfo(plr, infobuffer);
+
+    while (m_pendingUserInfo)
+    {
+        for (unsigned int i = 1; i <= m_maxClients; i++)
+        {
+            uint64_t bit = uint64_t(1) << i;
+            if (!(m_pendingUserInfo & bit))
+                continue;
+
+            m_pendingUserInfo &= ~bit;
+
+            Player *pendingPlr = m_players[i].get();
+            if (pendingPlr->isConnected())
+                _updateUserInfo(pendingPlr, GET_INFOKEYBUFFER(pendingPlr->getEdict()));
+        }
+    }
 }
 
-void PlayerMngr::StartFramePost()
+void PlayerMngr::_updateUserInfo(Player *plr,
+                                 const char *infobuffer)
+{
+    plr->updateUserInfo(infobuffer);
+
+    const Player::UserInfo &userInfo = plr->getUserInfoCore();
+    const Player::UserInfo &prevUserInfo = plr->getPrevUserInfoCore();
+
+    const char *name = userInfo.getValue("name");
+    _setName(plr, name ? name : "");
+
+    if (m_userInfoHooks.empty())
+        return;
+
+    m_userInfoHooksRunning = true;
+
+    // Changed and added keys
+    for (std::size_t i = 0; i < userInfo.getKeysNum(); ++i)
+    {
+        auto hooks = m_userInfoHooks.find(userInfo.getKey(i));
+        if (hooks == m_userInfoHooks.end())
+            continue;
+
+        const char *oldValue = prevUserInfo.getValue(userInfo.getKey(i));
+        if (oldValue && !std::strcmp(oldValue, userInfo.getValue(i)))
+            continue;
+
+        _runUserInfoHooks(plr, hooks->second, userInfo.getKey(i), oldValue ? oldValue : "", userInfo.getValue(i));
+    }
+
+    // Removed keys
+    for (std::size_t i = 0; i < prevUserInfo.getKeysNum(); ++i)
+    {
+        auto hooks = m_userInfoHooks.find(prevUserInfo.getKey(i));
+        if (hooks == m_userInfoHooks.end() || userInfo.getValue(prevUserInfo.getKey(i)))
+            continue;
+
+        _runUserInfoHooks(plr, hooks->second, prevUserInfo.getKey(i), prevUserInfo.getValue(i), "");
+    }
+
+    m_userInfoHooksRunning = false;
+}
+
+void PlayerMngr::_runUserInfoHooks(Player *plr,
+                                   const UserInfoHooks &hooks,
+                                   const char *key,
+                                   const char *oldValue,
+                                   const char *newValue)
+{
+    // Hooks can be added by the callbacks, so vectors are walked by index
+    for (std::size_t i = 0; i < hooks.listeners.size(); ++i)
+    {
+        hooks.listeners[i]->OnClientUserInfoChanged(plr, key, oldValue, newValue);
+    }
+
+    for (std::size_t i = 0; i < hooks.functions.size(); ++i)
+    {
+        SourcePawn::IPluginFunction *func = hooks.functions[i];
+
+        // Plugin has been paused
+        if (!func->IsRunnable())
+            continue;
+
+        func->PushCell(static_cast<cell_t>(plr->getIndex()));
+        func->PushString(key);
+        func->PushString(oldValue);
+        func->PushString(newValue);
+        {
+            Profiler::Scope profile(func, Profiler::Source::Forward);
+            func->Execute(nullptr);
+        }
+    }
+}
+
+void PlayerMngr::addUserInfoListener(const char *key,
+                                     IPlayerListener *listener)
+{
+    m_userInfoHooks[key].listeners.push_back(listener);
+}
+
+void PlayerMngr::removeUserInfoListener(const char *key,
+                                        IPlayerListener *listener)
+{
+    auto hooks = m_userInfoHooks.find(key);
+    if (hooks == m_userInfoHooks.end())
+        return;
+
+    auto &listeners = hooks->second.listeners;
+    listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+
+    if (listeners.empty() && hooks->second.functions.empty())
+        m_userInfoHooks.erase(hooks);
+}
+
+void PlayerMngr::addUserInfoHookCore(std::string_view key,
+                                     SourcePawn::IPluginFunction *func)
+{
+    m_userInfoHooks[std::string(key)].functions.push_back(func);
+}
+
+void PlayerMngr::clearUserInfoHooks()
+{
+    // Listeners of modules outlive plugins
+    for (auto iter = m_userInfoHooks.begin(); iter != m_userInfoHooks.end(); )
+    {
+        iter->second.functions.clear();
+
+        if (iter->second.listeners.empty())
+            iter = m_userInfoHooks.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+void PlayerMngr::_setName(Player *plr,
+                          std::string_view name)
 {
-    if (m_nextAuthCheck <= gpGlobals->time && !m_playersToAuth.empty())
+    plr->setName(name);
+
+    std::string &lowerName = m_lowerNames[plr->getIndex()];
+    lowerName.assign(name);
+    std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), [](unsigned char c)
     {
-        m_nextAuthCheck = gpGlobals->time + 0.5f;
+        return static_cast<char>(std::tolower(c));
+    });
+}
+
+Player *PlayerMngr::getPlayerByUserIdCore(int userid) const
+{
+    auto pair = m_userIdIndex.find(userid);
+
+    return (pair != m_userIdIndex.end()) ? m_players[pair->second].get() : nullptr;
+}
+
+Player *PlayerMngr::getPlayerBySteamIdCore(uint64_t steamid) const
+{
+    auto pair = m_steamIdIndex.find(steamid);
+
+    return (pair != m_steamIdIndex.end()) ? m_players[pair->second].get() : nullptr;
+}
+
+uint64_t PlayerMngr::steamIdTo64(std::string_view authid)
+{
+    static constexpr uint64_t steamIdBase = 76561197960265728ULL;
+
+    // STEAM_X:Y:Z
+    if (authid.compare(0, 6, "STEAM_") || authid.length() < 11)
+        return 0;
+
+    std::size_t firstColon = authid.find(':');
+    std::size_t secondColon = authid.find(':', firstColon + 1);
+    if (firstColon == std::string_view::npos || secondColon != firstColon + 2)
+        return 0;
 
-        auto iter = m_playersToAuth.begin();
-        while (iter != m_playersToAuth.end())
+    char authServer = authid[firstColon + 1];
+    if (authServer != '0' && authServer != '1')
+        return 0;
+
+    uint64_t accountId = 0;
+    std::string_view accountPart = authid.substr(secondColon + 1);
+    if (accountPart.empty())
+        return 0;
+
+    for (char digit : accountPart)
+    {
+        if (digit < '0' || digit > '9')
+            return 0;
+
+        accountId = accountId * 10 + static_cast<uint64_t>(digit - '0');
+    }
+
+    return steamIdBase + accountId * 2 + static_cast<uint64_t>(authServer - '0');
+}
+
+uint64_t PlayerMngr::_findByName(std::string_view name) const
+{
+    std::string lowerName(name);
+    std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), [](unsigned char c)
+    {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    uint64_t connected = getPlayerSet(PlayerSet::Connected);
+    uint64_t partialMatches = 0;
+
+    for (unsigned int i = 1; i <= m_maxClients; i++)
+    {
+        if (!(connected & (uint64_t(1) << i)))
+            continue;
+
+        // Exact match wins over any partial matches
+        if (m_lowerNames[i] == lowerName)
+            return uint64_t(1) << i;
+
+        if (m_lowerNames[i].find(lowerName) != std::string::npos)
+            partialMatches |= uint64_t(1) << i;
+    }
+
+    return partialMatches;
+}
+
+uint64_t PlayerMngr::filterPlayersCore(uint32_t include,
+                                      uint32_t exclude,
+                                      int team) const
+{
+    // Flags are bits in the order of player sets
+    uint64_t players = ~uint64_t(0);
+    for (std::size_t i = 0; i < setsNum; ++i)
+    {
+        uint64_t setPlayers = m_playerSets[i];
+
+        if (include & (1U << i))
+            players &= setPlayers;
+
+        if (exclude & (1U << i))
+            players &= ~setPlayers;
+    }
+
+    if (team >= 0)
+        players &= getTeamSet(static_cast<std::size_t>(team));
+
+    return players;
+}
+
+uint64_t PlayerMngr::resolveTargetCore(std::string_view pattern) const
+{
+    if (pattern.empty())
+        return 0;
+
+    uint64_t inGame = getPlayerSet(PlayerSet::InGame);
+
+    // Groups
+    if (pattern[0] == '@')
+    {
+        uint64_t alive = getPlayerSet(PlayerSet::Alive);
+        uint64_t bots = getPlayerSet(PlayerSet::Bot) | getPlayerSet(PlayerSet::HLTV);
+
+        if (pattern == "@all")
+            return inGame;
+        if (pattern == "@alive")
+            return inGame & alive;
+        if (pattern == "@dead")
+            return inGame & ~alive;
+        if (pattern == "@bots")
+            return inGame & getPlayerSet(PlayerSet::Bot);
+        if (pattern == "@humans")
+            return inGame & ~bots;
+
+        return 0;
+    }
+
+    // #userid
+    if (pattern[0] == '#' && pattern.length() > 1)
+    {
+        int userid = 0;
+        bool isNumber = true;
+        for (char digit : pattern.substr(1))
         {
-            std::shared_ptr<Player> plr = *iter;
-            std::string_view authid(GETPLAYERAUTHID(plr->getEdict()));
-            if (!authid.empty() && authid.compare("STEAM_ID_PENDING"))
+            if (digit < '0' || digit > '9')
             {
-                plr->authorize(authid);
-                iter = m_playersToAuth.erase(iter);
+                isNumber = false;
+                break;
             }
-            else
-                ++iter;
+            userid = userid * 10 + (digit - '0');
+        }
+
+        if (isNumber)
+        {
+            Player *plr = getPlayerByUserIdCore(userid);
+            return plr ? uint64_t(1) << plr->getIndex() : 0;
+        }
+    }
+
+    // Steam ID
+    if (uint64_t steamid = steamIdTo64(pattern); steamid)
+    {
+        Player *plr = getPlayerBySteamIdCore(steamid);
+        return plr ? uint64_t(1) << plr->getIndex() : 0;
+    }
+
+    return _findByName(pattern);
+}
+
+void PlayerMngr::StartFramePost()
+{
+    _updateSnapshot();
+
+    // Only the front needs to be checked as deadlines are in order
+    if (!m_authQueue.empty() && m_authQueue.front().deadline <= gpGlobals->time)
+        _processAuthQueue();
+}
+
+bool PlayerMngr::_tryAuthorize(Player *plr)
+{
+    using def = ForwardMngr::FwdDefault;
+
+    std::string_view authid(GETPLAYERAUTHID(plr->getEdict()));
+    if (authid.empty() || !authid.compare("STEAM_ID_PENDING"))
+        return false;
+
+    plr->authorize(authid);
+
+    if (uint64_t steamid = steamIdTo64(authid); steamid)
+        m_steamIdIndex[steamid] = plr->getIndex();
+
+    // Bots and HLTV can be recognized by their auth id as well
+    _setInSet(PlayerSet::Authorized, plr->getIndex(), true);
+    _setInSet(PlayerSet::Bot, plr->getIndex(), plr->isFake());
+    _setInSet(PlayerSet::HLTV, plr->getIndex(), plr->isHLTV());
+
+    // callback for modules
+    for (auto *listener : getListenerList())
+    {
+        listener->OnClientAuthorized(plr, plr->getSteamID());
+    }
+
+    Forward *forward = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientAuthorized);
+    forward->pushCell(plr->getIndex());
+    forward->pushString(plr->getSteamID());
+    forward->execFunc(nullptr);
+
+    return true;
+}
+
+void PlayerMngr::_processAuthQueue()
+{
+    while (!m_authQueue.empty() && m_authQueue.front().deadline <= gpGlobals->time)
+    {
+        AuthCheck check = std::move(m_authQueue.front());
+        m_authQueue.pop_front();
+
+        Player *plr = check.player;
+
+        // Player left or has been authorized in the meantime
+        if (!plr->isConnected() || plr->getUserId() != check.userID || plr->isAuthorized())
+            continue;
+
+        if (!_tryAuthorize(plr))
+            m_authQueue.push_back({ gpGlobals->time + authCheckInterval, plr, check.userID });
+    }
+}
+
+void PlayerMngr::_updateSnapshot()
+{
+    uint64_t alive = 0;
+    std::array<uint64_t, teamsNum> teams = {};
+
+    for (unsigned int i = 1; i <= m_maxClients; i++)
+    {
+        const Player *plr = m_players[i].get();
+        std::size_t originPos = i * 3;
+
+        if (!plr->isInGame())
+        {
+            m_snapshot.alive[i] = 0;
+            m_snapshot.team[i] = 0;
+            m_snapshot.health[i] = 0.0f;
+            m_snapshot.flags[i] = 0;
+            m_snapshot.inGame[i] = 0;
+            m_snapshot.bot[i] = 0;
+            m_snapshot.origin[originPos] = m_snapshot.origin[originPos + 1] = m_snapshot.origin[originPos + 2] = 0.0f;
+            continue;
         }
+
+        const entvars_t &vars = plr->getEdict()->v;
+
+        m_snapshot.alive[i] = plr->isAlive();
+        m_snapshot.team[i] = vars.team;
+        m_snapshot.health[i] = vars.health;
+        m_snapshot.flags[i] = vars.flags;
+        m_snapshot.inGame[i] = 1;
+        m_snapshot.bot[i] = plr->isFake();
+        m_snapshot.origin[originPos] = vars.origin.x;
+        m_snapshot.origin[originPos + 1] = vars.origin.y;
+        m_snapshot.origin[originPos + 2] = vars.origin.z;
+
+        if (m_snapshot.alive[i])
+            alive |= uint64_t(1) << i;
+
+        if (vars.team >= 0 && static_cast<std::size_t>(vars.team) < teamsNum)
+            teams[vars.team] |= uint64_t(1) << i;
     }
+
+    // Alive state and teams change without notice, so they follow the snapshot
+    m_playerSets[static_cast<std::size_t>(PlayerSet::Alive)] = alive;
+    m_teamSets = teams;
 }
 
 void PlayerMngr::ServerActivatePost(edict_t *pEdictList,
@@ -310,4 +825,13 @@ void PlayerMngr::ServerActivatePost(edict_t *pEdictList,
 {
     _setMaxClients(clientMax);
     _initPlayers(pEdictList);
+    m_snapshot = {};
+    m_authQueue.clear();
+    m_playerSets = {};
+    m_teamSets = {};
+    m_userIdIndex.clear();
+    m_steamIdIndex.clear();
+
+    for (auto &name : m_lowerNames)
+        name.clear();
 }
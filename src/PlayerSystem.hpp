@@ -20,10 +20,70 @@
 #include "spmod.hpp"
 
 class Menu;
+class MenuItem;
 
 class Player : public IPlayer
 {
 public:
+    /* parsed copy of client's infobuffer, keys and values are terminated in place */
+    class UserInfo
+    {
+    public:
+        /* engine limit of infobuffer length */
+        static constexpr std::size_t bufferSize = 256;
+
+        /* shortest pair \k\v takes 4 characters */
+        static constexpr std::size_t maxKeys = bufferSize / 4;
+
+        UserInfo() = default;
+        UserInfo(const UserInfo &other) = delete;
+        UserInfo &operator=(const UserInfo &other) = delete;
+
+        void parse(const char *infobuffer);
+        void clear();
+        const char *getValue(std::string_view key) const;
+
+        std::size_t getKeysNum() const
+        {
+            return m_keysNum;
+        }
+        const char *getKey(std::size_t position) const
+        {
+            return m_keys[position];
+        }
+        const char *getValue(std::size_t position) const
+        {
+            return m_values[position];
+        }
+
+    private:
+        std::array<char, bufferSize> m_buffer = {};
+        std::array<const char *, maxKeys> m_keys = {};
+        std::array<const char *, maxKeys> m_values = {};
+        std::size_t m_keysNum = 0;
+    };
+
+    /* what the player has been shown by the displayed menu */
+    struct MenuState
+    {
+        /* items behind the keys and keys which can be pressed */
+        std::array<MenuItem *, 10> slots = {};
+        int keys = 0;
+        int page = 0;
+
+        /* menu and its items version the slots were rendered for, ids aren't reused within a map unlike addresses */
+        std::size_t slotsMenu = 0;
+        std::size_t slotsVersion = 0;
+
+        /* first item of every visited page, valid for the menu and its items version */
+        const Menu *pagesMenu = nullptr;
+        std::size_t pagesVersion = 0;
+        std::vector<std::size_t> pageStarts;
+
+        /* bumped on every display, tells apart expiry of the menu shown now from the older ones */
+        std::size_t displayId = 0;
+    };
+
     Player() = delete;
     ~Player() = default;
     Player(edict_t *edict, unsigned int index);
@@ -40,6 +100,7 @@ public:
     bool isFake() const override;
     bool isHLTV() const override;
     bool isInGame() const override;
+    const char *getUserInfo(const char *key) const override;
 
     // Player
     std::string_view getNameCore() const;
@@ -51,6 +112,7 @@ public:
     void setMenu(std::shared_ptr<Menu> menu);
     int getMenuPage() const;
     void setMenuPage(int page);
+    MenuState &getMenuStateCore();
 
     void connect(std::string_view name,
                  std::string_view ip);
@@ -58,6 +120,11 @@ public:
     void disconnect();
     void putInServer();
     void authorize(std::string_view authid);
+    bool isAuthorized() const;
+
+    void updateUserInfo(const char *infobuffer);
+    const UserInfo &getUserInfoCore() const;
+    const UserInfo &getPrevUserInfoCore() const;
 
 private:
     edict_t *m_edict;
@@ -70,12 +137,60 @@ private:
     std::string m_steamID;
 
     std::weak_ptr<Menu> m_menu;
-    int m_menuPage;
+    MenuState m_menuState;
+
+    /* current and previous userinfo, swapped on every change so they can be diffed */
+    std::array<UserInfo, 2> m_userInfo;
+    std::size_t m_userInfoPos = 0;
 };
 
 class PlayerMngr : public IPlayerMngr
 {
 public:
+    /* fields of players snapshot */
+    enum class SnapshotField : uint8_t
+    {
+        Alive = 0,
+        Team,
+        Health,
+        Flags,
+        InGame,
+        Bot,
+        Origin
+    };
+
+    /* maintained sets of players */
+    enum class PlayerSet : uint8_t
+    {
+        Connected = 0,
+        InGame,
+        Alive,
+        Bot,
+        HLTV,
+        Authorized,
+
+        /* number of sets */
+        SetsNum
+    };
+    static constexpr std::size_t setsNum = static_cast<std::size_t>(PlayerSet::SetsNum);
+
+    /* teams tracked by team sets */
+    static constexpr std::size_t teamsNum = 8;
+
+    /* players state copied once per frame, column per field indexed by player index */
+    struct PlayersSnapshot
+    {
+        std::array<cell_t, MAX_PLAYERS + 1> alive;
+        std::array<cell_t, MAX_PLAYERS + 1> team;
+        std::array<float, MAX_PLAYERS + 1> health;
+        std::array<cell_t, MAX_PLAYERS + 1> flags;
+        std::array<cell_t, MAX_PLAYERS + 1> inGame;
+        std::array<cell_t, MAX_PLAYERS + 1> bot;
+
+        /* x, y, z of every player one after another */
+        std::array<float, (MAX_PLAYERS + 1) * 3> origin;
+    };
+
     PlayerMngr() = default;
     ~PlayerMngr() = default;
 
@@ -86,14 +201,40 @@ public:
     unsigned int getNumPlayers() const override;
     void addPlayerListener(IPlayerListener *listener) override;
     void removePlayerListener(IPlayerListener *listener) override;
+    void addUserInfoListener(const char *key,
+                             IPlayerListener *listener) override;
+    void removeUserInfoListener(const char *key,
+                                IPlayerListener *listener) override;
 
     // PlayerManager
-    std::shared_ptr<Player> getPlayerCore(int index) const;
-    std::shared_ptr<Player> getPlayerCore(edict_t *edict) const;
+    Player *getPlayerCore(int index) const;
+    Player *getPlayerCore(edict_t *edict) const;
     const auto &getListenerList() const
     {
         return m_playersListeners;
     }
+    const auto &getSnapshot() const
+    {
+        return m_snapshot;
+    }
+    uint64_t getPlayerSet(PlayerSet set) const
+    {
+        return m_playerSets[static_cast<std::size_t>(set)];
+    }
+    uint64_t getTeamSet(std::size_t team) const
+    {
+        return (team < teamsNum) ? m_teamSets[team] : 0;
+    }
+    Player *getPlayerByUserIdCore(int userid) const;
+    Player *getPlayerBySteamIdCore(uint64_t steamid) const;
+    uint64_t filterPlayersCore(uint32_t include,
+                               uint32_t exclude,
+                               int team) const;
+    uint64_t resolveTargetCore(std::string_view pattern) const;
+    static uint64_t steamIdTo64(std::string_view authid);
+    void addUserInfoHookCore(std::string_view key,
+                             SourcePawn::IPluginFunction *func);
+    void clearUserInfoHooks();
 
     bool ClientConnect(edict_t *pEntity,
                        const char *pszName,
@@ -105,6 +246,7 @@ public:
                            const char *pszAddress);
 
     void ClientPutInServerPost(edict_t *pEntity);
+    void SV_DropClientPost(edict_t *pEntity);
     void ClientUserInfoChangedPost(edict_t *pEntity,
                                    char *infobuffer);
     void StartFramePost();
@@ -116,12 +258,71 @@ public:
 private:
     void _setMaxClients(int maxClients);
     void _initPlayers(edict_t *edictList);
+    void _updateSnapshot();
+    void _setName(Player *plr,
+                  std::string_view name);
+    uint64_t _findByName(std::string_view name) const;
+    void _setInSet(PlayerSet set,
+                   unsigned int index,
+                   bool member);
+    bool _tryAuthorize(Player *plr);
+    void _processAuthQueue();
+    void _updateUserInfo(Player *plr,
+                         const char *infobuffer);
+
+    /* subscribers of a single userinfo key */
+    struct UserInfoHooks
+    {
+        std::vector<IPlayerListener *> listeners;
+        std::vector<SourcePawn::IPluginFunction *> functions;
+    };
 
-    std::vector<std::shared_ptr<Player>> m_playersToAuth;
-    float m_nextAuthCheck = 0.0f;
+    void _runUserInfoHooks(Player *plr,
+                           const UserInfoHooks &hooks,
+                           const char *key,
+                           const char *oldValue,
+                           const char *newValue);
+
+    /* player awaiting authorization */
+    struct AuthCheck
+    {
+        /* time of the next check */
+        float deadline;
 
-    std::array<std::shared_ptr<Player>, MAX_PLAYERS + 1> m_players;
-    unsigned int m_maxClients;
+        Player *player;
+
+        /* detects that player left and slot has been taken by someone else */
+        int userID;
+    };
+
+    /* delay between checks of pending player */
+    static constexpr float authCheckInterval = 0.25f;
+
+    /* checks sorted by deadline as every new one is scheduled after the previous ones */
+    std::deque<AuthCheck> m_authQueue;
+
+    std::array<std::unique_ptr<Player>, MAX_PLAYERS + 1> m_players;
+    unsigned int m_maxClients = 0;
 
     std::vector<IPlayerListener *> m_playersListeners;
+
+    PlayersSnapshot m_snapshot = {};
+
+    /* bit n is set if player with index n belongs to set */
+    std::array<uint64_t, setsNum> m_playerSets = {};
+    std::array<uint64_t, teamsNum> m_teamSets = {};
+
+    /* player indexes by userid and 64-bit Steam ID */
+    std::unordered_map<int, unsigned int> m_userIdIndex;
+    std::unordered_map<uint64_t, unsigned int> m_steamIdIndex;
+
+    /* lowercase names of players by their index */
+    std::array<std::string, MAX_PLAYERS + 1> m_lowerNames;
+
+    /* subscribers by userinfo key, only keys present here are diffed */
+    std::unordered_map<std::string, UserInfoHooks> m_userInfoHooks;
+
+    /* hooks can change userinfo again, such players are updated once they finish */
+    bool m_userInfoHooksRunning = false;
+    uint64_t m_pendingUserInfo = 0;
 };
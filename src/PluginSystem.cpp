@@ -55,21 +55,7 @@ Plugin::Plugin(std::size_t id,
     m_runtime = plugin;
     m_runtime->GetDefaultContext()->SetKey(1, const_cast<char *>(m_identity.c_str()));
 
-    uint32_t nativesNum = plugin->GetNativesNum();
-    const std::unique_ptr<NativeMngr> &nativeManager = gSPGlobal->getNativeManagerCore();
-    for (uint32_t index = 0; index < nativesNum; ++index)
-    {
-        const sp_native_t *pluginNative = m_runtime->GetNative(index);
-
-        if (pluginNative->status == SP_NATIVE_BOUND)
-            continue;
-
-        std::shared_ptr<Native> native = nativeManager->getNativeCore(pluginNative->name);
-        if (!native)
-            continue;
-
-        plugin->UpdateNativeBinding(index, native->getRouter(), 0, nullptr);
-    }
+    gSPGlobal->getNativeManagerCore()->bindNatives(plugin);
 
     // Setup maxclients num
     uint32_t maxClientsVarIndex;
@@ -146,22 +132,79 @@ std::string_view Plugin::getFileNameCore() const
 {
     return m_filename;
 }
+bool Plugin::isPaused() const
+{
+    return m_runtime->IsPaused();
+}
+void Plugin::setPaused(bool paused)
+{
+    m_runtime->SetPauseState(paused);
+}
+std::size_t Plugin::addWatchdogStrike()
+{
+    return ++m_watchdogStrikes;
+}
+bool Plugin::addFunctionError(SourcePawn::IPluginFunction *func)
+{
+    auto errorsLimit = static_cast<int>(gCvarBreakerErrors.value);
+    if (errorsLimit <= 0)
+        return false;
+
+    clock::time_point now = clock::now();
+    ErrorBreaker &breaker = m_errorBreakers[func];
+
+    // Start counting anew if previous window has passed
+    auto window = std::chrono::duration<float>(gCvarBreakerWindow.value);
+    if (!breaker.errors || now - breaker.windowStart > window)
+    {
+        breaker.errors = 0;
+        breaker.windowStart = now;
+    }
+
+    if (++breaker.errors < static_cast<std::size_t>(errorsLimit))
+        return false;
+
+    auto cooldown = std::chrono::duration<float>(gCvarBreakerCooldown.value);
+    breaker.disabledUntil = now + std::chrono::duration_cast<clock::duration>(cooldown);
+    breaker.errors = 0;
+
+    return true;
+}
+bool Plugin::isFunctionDisabled(SourcePawn::IPluginFunction *func)
+{
+    // Most of plugins never throw errors, so avoid the clock in that case
+    if (m_errorBreakers.empty())
+        return false;
+
+    auto breaker = m_errorBreakers.find(func);
+    if (breaker == m_errorBreakers.end())
+        return false;
+
+    return clock::now() < breaker->second.disabledUntil;
+}
+std::size_t Plugin::getDisabledFunctionsNum()
+{
+    clock::time_point now = clock::now();
+
+    return std::count_if(m_errorBreakers.begin(), m_errorBreakers.end(), [now](const auto &breaker)
+    {
+        return now < breaker.second.disabledUntil;
+    });
+}
 
 std::shared_ptr<Plugin> PluginMngr::getPluginCore(std::string_view name)
 {
-    auto result = m_plugins.find(name.data());
+    auto result = m_pluginsIndex.find(name.data());
 
-    return (result != m_plugins.end()) ? result->second : nullptr;
+    return (result != m_pluginsIndex.end()) ? m_plugins[result->second] : nullptr;
 }
 
 std::shared_ptr<Plugin> PluginMngr::getPluginCore(std::size_t index)
 {
-    for (const auto &entry : m_plugins)
-    {
-        if (entry.second->getId() == index)
-            return entry.second;
-    }
-    return nullptr;
+    if (index >= m_plugins.size())
+        return nullptr;
+
+    return m_plugins[index];
 }
 
 std::shared_ptr<Plugin> PluginMngr::getPluginCore(SourcePawn::IPluginContext *ctx)
@@ -208,6 +251,9 @@ std::shared_ptr<Plugin> PluginMngr::_loadPlugin(const fs::path &path,
         return nullptr;
 
     std::string fileName = path.stem().string();
+    if (m_pluginsIndex.find(fileName) != m_pluginsIndex.end())
+        return nullptr;
+
     std::shared_ptr<Plugin> plugin;
     try
     {
@@ -219,12 +265,50 @@ std::shared_ptr<Plugin> PluginMngr::_loadPlugin(const fs::path &path,
         return nullptr;
     }
 
-    if (!m_plugins.try_emplace(fileName, plugin).second)
-        return nullptr;
+    m_pluginsIndex.emplace(fileName, pluginId);
+    m_plugins.push_back(plugin);
 
     return plugin;
 }
 
+void PluginMngr::_sortByLoadOrder(std::vector<fs::path> &plugins) const
+{
+    std::ifstream orderFile(gSPGlobal->getConfigsDirCore() / PluginMngr::loadOrderFile);
+    if (!orderFile.is_open())
+        return;
+
+    // Listed plugins are moved to the front, in order they appear in the file
+    auto insertPos = plugins.begin();
+    std::string line;
+    while (std::getline(orderFile, line))
+    {
+        std::size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos)
+            continue;
+
+        line = line.substr(first, line.find_last_not_of(" \t\r") - first + 1);
+        if (line.front() == ';' || !line.compare(0, 2, "//"))
+            continue;
+
+        if (fs::path(line).extension().empty())
+            line += ".smx";
+
+        auto iter = std::find_if(insertPos, plugins.end(), [&line](const fs::path &path)
+        {
+            return path.filename().string() == line;
+        });
+
+        if (iter == plugins.end())
+        {
+            gSPGlobal->getLoggerCore()->LogMessageCore("Plugin ", line, " from load order file not found");
+            continue;
+        }
+
+        std::rotate(insertPos, iter, iter + 1);
+        ++insertPos;
+    }
+}
+
 std::size_t PluginMngr::loadPlugins()
 {
     using def = ForwardMngr::FwdDefault;
@@ -239,10 +323,17 @@ std::size_t PluginMngr::loadPlugins()
         return 0;
     }
 
-    std::string errorMsg;
+    // Sort them, so the load order doesn't depend on the filesystem
+    std::vector<fs::path> pluginsToLoad;
     for (const auto &entry : directoryIter)
+        pluginsToLoad.push_back(entry.path());
+
+    std::sort(pluginsToLoad.begin(), pluginsToLoad.end());
+    _sortByLoadOrder(pluginsToLoad);
+
+    std::string errorMsg;
+    for (const auto &filePath : pluginsToLoad)
     {
-        fs::path filePath = entry.path();
         if (!_loadPlugin(filePath, &errorMsg) && !errorMsg.empty())
         {
             loggingSystem->LogErrorCore(errorMsg);
@@ -257,24 +348,8 @@ std::size_t PluginMngr::loadPlugins()
 
     // Try to bind unbound natives
     const std::unique_ptr<NativeMngr> &nativeManager = gSPGlobal->getNativeManagerCore();
-    for (const auto &entry : m_plugins)
-    {
-        SourcePawn::IPluginRuntime *runtime = entry.second->getRuntime();
-        uint32_t nativesNum = runtime->GetNativesNum();
-        for (uint32_t index = 0; index < nativesNum; ++index)
-        {
-            const sp_native_t *pluginNative = runtime->GetNative(index);
-
-            if (pluginNative->status == SP_NATIVE_BOUND)
-                continue;
-
-            std::shared_ptr<Native> native = nativeManager->getNativeCore(pluginNative->name);
-            if (!native)
-                continue;
-
-            runtime->UpdateNativeBinding(index, native->getRouter(), 0, nullptr);
-        }
-    }
+    for (const auto &plugin : m_plugins)
+        nativeManager->bindNatives(plugin->getRuntime());
 
     fwdMngr->getDefaultForward(def::PluginInit)->execFunc(nullptr);
     fwdMngr->getDefaultForward(def::PluginsLoaded)->execFunc(nullptr);
@@ -304,6 +379,8 @@ IPlugin *PluginMngr::getPlugin(SourcePawn::IPluginContext *ctx)
 void PluginMngr::clearPlugins()
 {
     m_plugins.clear();
+    m_pluginsIndex.clear();
+    m_epoch++;
 }
 
 void PluginMngr::setPluginPrecache(bool canprecache)
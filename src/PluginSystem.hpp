@@ -52,8 +52,29 @@ public:
     std::string_view getUrlCore() const;
     std::string_view getIndentityCore() const;
     std::string_view getFileNameCore() const;
+    bool isPaused() const;
+    void setPaused(bool paused);
+    std::size_t addWatchdogStrike();
+    bool addFunctionError(SourcePawn::IPluginFunction *func);
+    bool isFunctionDisabled(SourcePawn::IPluginFunction *func);
+    std::size_t getDisabledFunctionsNum();
 
 private:
+    using clock = std::chrono::steady_clock;
+
+    /* error circuit breaker state of a function */
+    struct ErrorBreaker
+    {
+        /* errors counted in the current window */
+        std::size_t errors = 0;
+
+        /* start of the current window */
+        clock::time_point windowStart;
+
+        /* function is skipped by dispatch until then */
+        clock::time_point disabledUntil;
+    };
+
     SourcePawn::IPluginRuntime *m_runtime;
     std::string m_identity;
     std::string m_filename;
@@ -62,6 +83,12 @@ private:
     std::string m_author;
     std::string m_url;
     std::size_t m_id;
+
+    /* how many times watchdog aborted the plugin */
+    std::size_t m_watchdogStrikes = 0;
+
+    /* functions which have thrown errors */
+    std::unordered_map<SourcePawn::IPluginFunction *, ErrorBreaker> m_errorBreakers;
 };
 
 class PluginMngr final : public IPluginMngr
@@ -80,10 +107,16 @@ public:
                         std::size_t size) override;
 
     // PluginMngr
+    static constexpr auto *loadOrderFile = "plugins.ini";
+
     const auto &getPluginsList() const
     {
         return m_plugins;
     }
+    std::size_t getEpoch() const
+    {
+        return m_epoch;
+    }
     void clearPlugins();
     void setPluginPrecache(bool canprecache);
     bool canPluginPrecache();
@@ -98,7 +131,16 @@ public:
 private:
     std::shared_ptr<Plugin> _loadPlugin(const fs::path &path,
                                         std::string *error);
-    std::unordered_map<std::string, std::shared_ptr<Plugin>> m_plugins;
+    void _sortByLoadOrder(std::vector<fs::path> &plugins) const;
+
+    /* plugins in load order, plugin id is its position */
+    std::vector<std::shared_ptr<Plugin>> m_plugins;
+
+    /* maps plugin identity to its position in m_plugins */
+    std::unordered_map<std::string, std::size_t> m_pluginsIndex;
+
+    /* bumped whenever plugins are removed from the list */
+    std::size_t m_epoch = 0;
 
     // Allow plugins to precache
     bool m_canPluginsPrecache;
@@ -0,0 +1,331 @@
+/*  SPMod - SourcePawn Scripting Engine for Half-Life
+ *  Copyright (C) 2018  SPMod Development Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "spmod.hpp"
+
+int gmsgTextMsg = 0;
+
+// TextMsg destinations used by games
+static constexpr int printCenter = 4;
+static constexpr int printTalk = 3;
+
+static int fixedSigned16(float value,
+                         float scale)
+{
+    return std::clamp(static_cast<int>(value * scale), -32768, 32767);
+}
+
+static int fixedUnsigned16(float value,
+                           float scale)
+{
+    return std::clamp(static_cast<int>(value * scale), 0, 65535);
+}
+
+bool PrintMngr::print(unsigned int player,
+                      PrintDest dest,
+                      const char *text,
+                      PrintPriority priority)
+{
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(static_cast<int>(player));
+    if (!plr)
+        return false;
+
+    return printCore(plr, dest, text, priority);
+}
+
+bool PrintMngr::printHud(unsigned int player,
+                         const HudParams &params,
+                         const char *text,
+                         PrintPriority priority)
+{
+    Player *plr = gSPGlobal->getPlayerManagerCore()->getPlayerCore(static_cast<int>(player));
+    if (!plr)
+        return false;
+
+    return printHudCore(plr, params, text, priority);
+}
+
+bool PrintMngr::printCore(Player *player,
+                          PrintDest dest,
+                          std::string_view text,
+                          PrintPriority priority)
+{
+    return _queue(player, static_cast<uint8_t>(dest), text, priority, nullptr);
+}
+
+bool PrintMngr::printHudCore(Player *player,
+                             const HudParams &params,
+                             std::string_view text,
+                             PrintPriority priority)
+{
+    if (params.channel < 1 || params.channel > 4)
+        return false;
+
+    return _queue(player, hudDest, text, priority, &params);
+}
+
+void PrintMngr::flush()
+{
+    if (!m_pending)
+        return;
+
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
+
+    for (unsigned int i = 1; i <= plrMngr->getMaxClients(); i++)
+    {
+        if (!(m_pending & (uint64_t(1) << i)))
+            continue;
+
+        Player *plr = plrMngr->getPlayerCore(i);
+        Queue &queue = m_queues[i];
+
+        // Player could have left since the text has been queued
+        if (plr->isInGame())
+            _flushQueue(plr, queue);
+
+        queue.text.clear();
+        queue.entries.clear();
+        queue.queuedBytes = 0;
+    }
+
+    m_pending = 0;
+}
+
+void PrintMngr::clearQueues()
+{
+    for (Queue &queue : m_queues)
+    {
+        queue.text.clear();
+        queue.entries.clear();
+        queue.queuedBytes = 0;
+    }
+
+    m_pending = 0;
+}
+
+bool PrintMngr::_queue(Player *player,
+                       uint8_t dest,
+                       std::string_view text,
+                       PrintPriority priority,
+                       const HudParams *hud)
+{
+    // Bots have no client to print to
+    if (!player->isInGame() || player->isFake())
+        return false;
+
+    // Single text can never take more than the whole budget
+    text = text.substr(0, maxQueuedBytes - 1);
+
+    Queue &queue = m_queues[player->getIndex()];
+    std::size_t length = text.length() + 1;
+
+    if (!_makeRoom(queue, length, priority))
+        return false;
+
+    queue.entries.push_back({ dest, priority, false, queue.text.length(), text.length(), hud ? *hud : HudParams() });
+    queue.text.append(text);
+    queue.queuedBytes += length;
+
+    m_pending |= uint64_t(1) << player->getIndex();
+
+    return true;
+}
+
+bool PrintMngr::_makeRoom(Queue &queue,
+                          std::size_t length,
+                          PrintPriority priority)
+{
+    while (queue.queuedBytes + length > maxQueuedBytes)
+    {
+        // Newest text of the lowest priority is dropped first
+        Entry *victim = nullptr;
+        for (auto iter = queue.entries.rbegin(); iter != queue.entries.rend(); ++iter)
+        {
+            if (iter->dropped || iter->priority >= priority)
+                continue;
+
+            if (!victim || iter->priority < victim->priority)
+                victim = &*iter;
+        }
+
+        // Everything queued matters as much as the new text
+        if (!victim)
+            return false;
+
+        victim->dropped = true;
+        queue.queuedBytes -= victim->length + 1;
+    }
+
+    return true;
+}
+
+void PrintMngr::_flushQueue(Player *player,
+                            Queue &queue)
+{
+    std::string_view text(queue.text);
+
+    for (uint8_t dest = 0; dest < destsNum; ++dest)
+    {
+        const HudParams *chunkHud = nullptr;
+
+        for (const Entry &entry : queue.entries)
+        {
+            if (entry.dropped || entry.dest != dest)
+                continue;
+
+            // HUD messages are merged only if they look the same
+            if (chunkHud && dest == hudDest && !_isSameHud(*chunkHud, entry.hud))
+                _sendChunk(player, dest, *chunkHud);
+
+            chunkHud = &entry.hud;
+            _appendLine(player, dest, entry.hud, text.substr(entry.offset, entry.length));
+        }
+
+        if (chunkHud)
+            _sendChunk(player, dest, *chunkHud);
+    }
+}
+
+void PrintMngr::_appendLine(Player *player,
+                            uint8_t dest,
+                            const HudParams &hud,
+                            std::string_view line)
+{
+    std::size_t limit = _getLimit(dest);
+
+    if (!m_chunk.empty())
+    {
+        // Lines are separated by new line within a message
+        if (m_chunk.length() + 1 + line.length() <= limit)
+        {
+            m_chunk.push_back('\n');
+            m_chunk.append(line);
+            return;
+        }
+
+        _sendChunk(player, dest, hud);
+    }
+
+    // Line longer than a message is split
+    while (line.length() > limit)
+    {
+        std::size_t length = _getSplitLength(line, limit);
+
+        m_chunk.assign(line.substr(0, length));
+        _sendChunk(player, dest, hud);
+        line.remove_prefix(length);
+    }
+
+    m_chunk.assign(line);
+}
+
+void PrintMngr::_sendChunk(Player *player,
+                           uint8_t dest,
+                           const HudParams &hud)
+{
+    if (m_chunk.empty())
+        return;
+
+    edict_t *edict = player->getEdict();
+
+    if (dest == hudDest)
+    {
+        MESSAGE_BEGIN(MSG_ONE_UNRELIABLE, SVC_TEMPENTITY, nullptr, edict);
+        WRITE_BYTE(TE_TEXTMESSAGE);
+        WRITE_BYTE(hud.channel & 0xFF);
+        WRITE_SHORT(fixedSigned16(hud.x, 1 << 13));
+        WRITE_SHORT(fixedSigned16(hud.y, 1 << 13));
+        WRITE_BYTE(hud.effect);
+        WRITE_BYTE(hud.color[0]);
+        WRITE_BYTE(hud.color[1]);
+        WRITE_BYTE(hud.color[2]);
+        WRITE_BYTE(hud.color[3]);
+        WRITE_BYTE(hud.effectColor[0]);
+        WRITE_BYTE(hud.effectColor[1]);
+        WRITE_BYTE(hud.effectColor[2]);
+        WRITE_BYTE(hud.effectColor[3]);
+        WRITE_SHORT(fixedUnsigned16(hud.fadeInTime, 1 << 8));
+        WRITE_SHORT(fixedUnsigned16(hud.fadeOutTime, 1 << 8));
+        WRITE_SHORT(fixedUnsigned16(hud.holdTime, 1 << 8));
+
+        if (hud.effect == 2)
+            WRITE_SHORT(fixedUnsigned16(hud.fxTime, 1 << 8));
+
+        WRITE_STRING(m_chunk.c_str());
+        MESSAGE_END();
+
+        m_chunk.clear();
+        return;
+    }
+
+    auto printDest = static_cast<PrintDest>(dest);
+
+    // Console and chat need the line to be finished, limits leave room for it
+    if (printDest != PrintDest::Center)
+        m_chunk.push_back('\n');
+
+    if (printDest == PrintDest::Console)
+        CLIENT_PRINTF(edict, print_console, m_chunk.c_str());
+    else if (gmsgTextMsg)
+    {
+        MESSAGE_BEGIN(MSG_ONE, gmsgTextMsg, nullptr, edict);
+        WRITE_BYTE(printDest == PrintDest::Chat ? printTalk : printCenter);
+        WRITE_STRING(m_chunk.c_str());
+        MESSAGE_END();
+    }
+    else
+        CLIENT_PRINTF(edict, printDest == PrintDest::Chat ? print_chat : print_center, m_chunk.c_str());
+
+    m_chunk.clear();
+}
+
+std::size_t PrintMngr::_getSplitLength(std::string_view line,
+                                       std::size_t limit)
+{
+    // Don't cut UTF-8 sequence, step back to its lead byte
+    std::size_t length = limit;
+    while (length && (static_cast<unsigned char>(line[length]) & 0xC0) == 0x80)
+        length--;
+
+    // Not a valid UTF-8, cut it anyway
+    return length ? length : limit;
+}
+
+std::size_t PrintMngr::_getLimit(uint8_t dest)
+{
+    switch (dest)
+    {
+        case static_cast<uint8_t>(PrintDest::Console):
+            return consoleLength - 1;
+        case static_cast<uint8_t>(PrintDest::Center):
+            return textMsgLength;
+        case static_cast<uint8_t>(PrintDest::Chat):
+            return textMsgLength - 1;
+        default:
+            return hudLength;
+    }
+}
+
+bool PrintMngr::_isSameHud(const HudParams &a,
+                           const HudParams &b)
+{
+    return a.x == b.x && a.y == b.y && a.effect == b.effect && a.channel == b.channel
+        && std::equal(std::begin(a.color), std::end(a.color), std::begin(b.color))
+        && std::equal(std::begin(a.effectColor), std::end(a.effectColor), std::begin(b.effectColor))
+        && a.fadeInTime == b.fadeInTime && a.fadeOutTime == b.fadeOutTime
+        && a.holdTime == b.holdTime && a.fxTime == b.fxTime;
+}
@@ -0,0 +1,117 @@
+/*  SPMod - SourcePawn Scripting Engine for Half-Life
+ *  Copyright (C) 2018  SPMod Development Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "spmod.hpp"
+
+class PrintMngr final : public IPrintMngr
+{
+public:
+    /* longest text of a single message, merged lines never go over it */
+    static constexpr std::size_t textMsgLength = 190;
+    static constexpr std::size_t consoleLength = 512;
+    static constexpr std::size_t hudLength = 480;
+
+    /* text queued to a player during a frame, keeps prints well within reliable buffer the game uses too */
+    static constexpr std::size_t maxQueuedBytes = 1024;
+
+    PrintMngr() = default;
+    ~PrintMngr() = default;
+
+    // IPrintMngr
+    bool print(unsigned int player,
+               PrintDest dest,
+               const char *text,
+               PrintPriority priority) override;
+    bool printHud(unsigned int player,
+                  const HudParams &params,
+                  const char *text,
+                  PrintPriority priority) override;
+
+    // PrintMngr
+    bool printCore(Player *player,
+                   PrintDest dest,
+                   std::string_view text,
+                   PrintPriority priority);
+    bool printHudCore(Player *player,
+                      const HudParams &params,
+                      std::string_view text,
+                      PrintPriority priority);
+
+    void flush();
+    void clearQueues();
+
+private:
+    /* HUD goes after public destinations */
+    static constexpr uint8_t hudDest = static_cast<uint8_t>(PrintDest::Chat) + 1;
+    static constexpr uint8_t destsNum = hudDest + 1;
+
+    /* single queued text */
+    struct Entry
+    {
+        uint8_t dest;
+        PrintPriority priority;
+        bool dropped;
+
+        /* text is kept in the queue buffer */
+        std::size_t offset;
+        std::size_t length;
+
+        HudParams hud;
+    };
+
+    /* text queued to a player, containers keep their capacity between frames */
+    struct Queue
+    {
+        std::string text;
+        std::vector<Entry> entries;
+        std::size_t queuedBytes = 0;
+    };
+
+    bool _queue(Player *player,
+                uint8_t dest,
+                std::string_view text,
+                PrintPriority priority,
+                const HudParams *hud);
+    bool _makeRoom(Queue &queue,
+                   std::size_t length,
+                   PrintPriority priority);
+    void _flushQueue(Player *player,
+                     Queue &queue);
+    void _appendLine(Player *player,
+                     uint8_t dest,
+                     const HudParams &hud,
+                     std::string_view line);
+    void _sendChunk(Player *player,
+                    uint8_t dest,
+                    const HudParams &hud);
+
+    static std::size_t _getSplitLength(std::string_view line,
+                                       std::size_t limit);
+    static std::size_t _getLimit(uint8_t dest);
+    static bool _isSameHud(const HudParams &a,
+                           const HudParams &b);
+
+    std::array<Queue, MAX_PLAYERS + 1> m_queues;
+
+    /* bit n is set if player with index n has something queued */
+    uint64_t m_pending = 0;
+
+    /* text of the message being built */
+    std::string m_chunk;
+};
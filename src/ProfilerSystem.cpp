@@ -0,0 +1,231 @@
+/*  SPMod - SourcePawn Scripting Engine for Half-Life
+ *  Copyright (C) 2018  SPMod Development Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "spmod.hpp"
+
+void Profiler::Stats::add(clock::duration time)
+{
+    m_calls++;
+    m_total += time;
+
+    if (time > m_max)
+        m_max = time;
+
+    auto micro = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+
+    // Bucket n holds times up to 2^n microseconds
+    std::size_t bucket = 0;
+    while (micro && bucket < bucketsNum - 1)
+    {
+        micro >>= 1;
+        bucket++;
+    }
+
+    m_histogram[bucket]++;
+}
+
+void Profiler::Stats::reset()
+{
+    *this = Stats();
+}
+
+Profiler::clock::duration Profiler::Stats::getPercentile(double percentile) const
+{
+    if (!m_calls)
+        return clock::duration::zero();
+
+    auto callsToReach = static_cast<std::uint64_t>(std::ceil(m_calls * percentile / 100.0));
+    std::uint64_t callsSum = 0;
+
+    for (std::size_t bucket = 0; bucket < bucketsNum; ++bucket)
+    {
+        callsSum += m_histogram[bucket];
+
+        if (callsSum >= callsToReach)
+        {
+            // Upper bound of the bucket, but never more than actually measured
+            auto bound = std::chrono::duration_cast<clock::duration>(std::chrono::microseconds(1ULL << bucket));
+            return std::min(bound, m_max);
+        }
+    }
+
+    return m_max;
+}
+
+void Profiler::Scope::_finish()
+{
+    clock::duration time = clock::now() - m_start;
+
+    gSPGlobal->getProfilerCore()->record(m_func->GetParentRuntime(), m_source, time);
+}
+
+void Profiler::setEnabled(bool enable)
+{
+    m_enabled = enable;
+}
+
+void Profiler::record(SourcePawn::IPluginRuntime *runtime,
+                      Source source,
+                      clock::duration time)
+{
+    m_stats[runtime][static_cast<std::size_t>(source)].add(time);
+}
+
+void Profiler::recordNative(const Native *native,
+                            SourcePawn::IPluginRuntime *runtime,
+                            clock::duration time)
+{
+    m_nativeStats[native][runtime].add(time);
+}
+
+void Profiler::resetStats()
+{
+    m_stats.clear();
+    m_nativeStats.clear();
+}
+
+void Profiler::printSnapshot() const
+{
+    static constexpr std::array<const char *, sourcesNum> sourceNames =
+    {
+        "forward",
+        "timer",
+        "command",
+        "cvar",
+        "menu",
+        "native"
+    };
+
+    static constexpr std::size_t pluginWidth = 25;
+    static constexpr std::size_t sourceWidth = 10;
+    static constexpr std::size_t numWidth = 12;
+
+    auto &logSystem = gSPGlobal->getLoggerCore();
+    auto toMicro = [](clock::duration time)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+    };
+
+    logSystem->LogConsoleCore(std::left,
+                              "\n",
+                              std::setw(pluginWidth),
+                              "plugin",
+                              std::setw(sourceWidth),
+                              "source",
+                              std::setw(numWidth),
+                              "calls",
+                              std::setw(numWidth),
+                              "total us",
+                              std::setw(numWidth),
+                              "max us",
+                              "p99 us");
+
+    for (const auto &plugin : gSPGlobal->getPluginManagerCore()->getPluginsList())
+    {
+        auto pluginStats = m_stats.find(plugin->getRuntime());
+        if (pluginStats == m_stats.end())
+            continue;
+
+        for (std::size_t source = 0; source < sourcesNum; ++source)
+        {
+            const Stats &stats = pluginStats->second[source];
+            if (!stats.getCalls())
+                continue;
+
+            logSystem->LogConsoleCore(std::left,
+                                      std::setw(pluginWidth),
+                                      plugin->getFileNameCore().substr(0, pluginWidth - 1),
+                                      std::setw(sourceWidth),
+                                      sourceNames[source],
+                                      std::setw(numWidth),
+                                      stats.getCalls(),
+                                      std::setw(numWidth),
+                                      toMicro(stats.getTotal()),
+                                      std::setw(numWidth),
+                                      toMicro(stats.getMax()),
+                                      toMicro(stats.getPercentile(99.0)));
+        }
+    }
+}
+
+void Profiler::printNativesSnapshot() const
+{
+    static constexpr std::size_t nativeWidth = 30;
+    static constexpr std::size_t pluginWidth = 25;
+    static constexpr std::size_t numWidth = 12;
+
+    struct NativeRow
+    {
+        std::string_view native;
+        SourcePawn::IPluginRuntime *runtime;
+        const Stats *stats;
+    };
+
+    std::vector<NativeRow> rows;
+    for (const auto &[native, callers] : m_nativeStats)
+    {
+        for (const auto &[runtime, stats] : callers)
+            rows.push_back({ native->getNameCore(), runtime, &stats });
+    }
+
+    // Most expensive natives first
+    std::sort(rows.begin(), rows.end(), [](const NativeRow &a, const NativeRow &b)
+    {
+        return a.stats->getTotal() > b.stats->getTotal();
+    });
+
+    auto &logSystem = gSPGlobal->getLoggerCore();
+    const std::unique_ptr<PluginMngr> &plMngr = gSPGlobal->getPluginManagerCore();
+    auto toMicro = [](clock::duration time)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+    };
+
+    logSystem->LogConsoleCore(std::left,
+                              "\n",
+                              std::setw(nativeWidth),
+                              "native",
+                              std::setw(pluginWidth),
+                              "plugin",
+                              std::setw(numWidth),
+                              "calls",
+                              std::setw(numWidth),
+                              "total us",
+                              std::setw(numWidth),
+                              "max us",
+                              "p99 us");
+
+    for (const auto &row : rows)
+    {
+        std::shared_ptr<Plugin> plugin = plMngr->getPluginCore(row.runtime->GetDefaultContext());
+        if (!plugin)
+            continue;
+
+        logSystem->LogConsoleCore(std::left,
+                                  std::setw(nativeWidth),
+                                  row.native.substr(0, nativeWidth - 1),
+                                  std::setw(pluginWidth),
+                                  plugin->getFileNameCore().substr(0, pluginWidth - 1),
+                                  std::setw(numWidth),
+                                  row.stats->getCalls(),
+                                  std::setw(numWidth),
+                                  toMicro(row.stats->getTotal()),
+                                  std::setw(numWidth),
+                                  toMicro(row.stats->getMax()),
+                                  toMicro(row.stats->getPercentile(99.0)));
+    }
+}
@@ -0,0 +1,127 @@
+/*  SPMod - SourcePawn Scripting Engine for Half-Life
+ *  Copyright (C) 2018  SPMod Development Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "spmod.hpp"
+
+class Profiler final
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    /* entry points through which plugins are called */
+    enum class Source : uint8_t
+    {
+        Forward = 0,
+        Timer,
+        Command,
+        Cvar,
+        Menu,
+        Native
+    };
+
+    static constexpr std::size_t sourcesNum = static_cast<std::size_t>(Source::Native) + 1;
+
+    /* rolling counters of a measured code path */
+    class Stats
+    {
+    public:
+        void add(clock::duration time);
+        void reset();
+
+        std::uint64_t getCalls() const
+        {
+            return m_calls;
+        }
+        clock::duration getTotal() const
+        {
+            return m_total;
+        }
+        clock::duration getMax() const
+        {
+            return m_max;
+        }
+        clock::duration getPercentile(double percentile) const;
+
+    private:
+        /* power of two buckets in microseconds, enough for over half an hour */
+        static constexpr std::size_t bucketsNum = 32;
+
+        std::uint64_t m_calls = 0;
+        clock::duration m_total = clock::duration::zero();
+        clock::duration m_max = clock::duration::zero();
+        std::array<std::uint64_t, bucketsNum> m_histogram = {};
+    };
+
+    /* measures time of a single call into plugin */
+    class Scope
+    {
+    public:
+        Scope(SourcePawn::IPluginFunction *func,
+              Source source) : m_func(Profiler::m_enabled ? func : nullptr),
+                               m_source(source)
+        {
+            if (m_func)
+                m_start = clock::now();
+        }
+        ~Scope()
+        {
+            if (m_func)
+                _finish();
+        }
+
+        Scope(const Scope &other) = delete;
+        Scope &operator=(const Scope &other) = delete;
+
+    private:
+        void _finish();
+
+        SourcePawn::IPluginFunction *m_func;
+        Source m_source;
+        clock::time_point m_start;
+    };
+
+    Profiler() = default;
+    ~Profiler() = default;
+
+    static bool isEnabled()
+    {
+        return m_enabled;
+    }
+
+    void setEnabled(bool enable);
+    void record(SourcePawn::IPluginRuntime *runtime,
+                Source source,
+                clock::duration time);
+    void recordNative(const Native *native,
+                      SourcePawn::IPluginRuntime *runtime,
+                      clock::duration time);
+    void resetStats();
+    void printSnapshot() const;
+    void printNativesSnapshot() const;
+
+private:
+    /* checked by every scope, kept static so disabled profiler costs a single branch */
+    static inline bool m_enabled = false;
+
+    /* counters of every plugin, split by entry point */
+    std::unordered_map<SourcePawn::IPluginRuntime *, std::array<Stats, sourcesNum>> m_stats;
+
+    /* counters of natives called through profiling trampolines, split by calling plugin */
+    std::unordered_map<const Native *, std::unordered_map<SourcePawn::IPluginRuntime *, Stats>> m_nativeStats;
+};
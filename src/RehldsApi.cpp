@@ -31,15 +31,15 @@ static void SV_DropClientHook(IRehldsHook_SV_DropClient *chain,
     using def = ForwardMngr::FwdDefault;
 
     const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
-    std::shared_ptr<Player> plr = plrMngr->getPlayerCore(client->GetEdict());
+    Player *plr = plrMngr->getPlayerCore(client->GetEdict());
 
     // callback for modules
     for (auto *listener : plrMngr->getListenerList())
     {
-        listener->OnClientDisconnect(plr.get(), crash, string);
+        listener->OnClientDisconnect(plr, crash, string);
     }
 
-    std::shared_ptr<Forward> forward = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientDisconnect);
+    Forward *forward = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientDisconnect);
     forward->pushCell(plr->getIndex());
     forward->pushCell(crash);
     forward->pushString(string);
@@ -49,11 +49,12 @@ static void SV_DropClientHook(IRehldsHook_SV_DropClient *chain,
 
     PlayerMngr::m_playersNum--;
     plr->disconnect();
+    plrMngr->SV_DropClientPost(client->GetEdict());
 
     // callback for modules
     for (auto *listener : plrMngr->getListenerList())
     {
-        listener->OnClientDisconnected(plr.get(), crash, string);
+        listener->OnClientDisconnected(plr, crash, string);
     }
 
     //TODO: Add OnClientDisconnected(int client, bool crash, const char[] string) for plugins?
@@ -63,11 +64,13 @@ static void Cvar_DirectSetHook(IRehldsHook_Cvar_DirectSet *chain,
                                cvar_t *cvar,
                                const char *value)
 {
-    auto cachedCvar = gSPGlobal->getCvarManagerCore()->findCvarCore(cvar->name, true);
+    // Cvars which are not tracked by SPMod cost a single lookup by pointer
+    auto cachedCvar = gSPGlobal->getCvarManagerCore()->findCvarCore(cvar);
     // If cached cvar is the same, do not update cached value
     if (cachedCvar && cachedCvar->asStringCore().compare(value))
     {
-        cachedCvar->setValue(value);
+        // Engine sets the value itself once the chain is called
+        cachedCvar->updateValueCore(value);
     }
 
     chain->callNext(cvar, value);
@@ -30,13 +30,18 @@ SPGlobal::SPGlobal(fs::path &&dllDir) : m_SPModDir(dllDir.parent_path().parent_p
                                         m_menuManager(std::make_unique<MenuMngr>()),
                                         m_plrManager(std::make_unique<PlayerMngr>()),
                                         m_utils(std::make_unique<Utils>()),
+                                        m_profiler(std::make_unique<Profiler>()),
+                                        m_msgManager(std::make_unique<MessageMngr>()),
+                                        m_printManager(std::make_unique<PrintMngr>()),
                                         m_modName(GET_GAME_INFO(PLID, GINFO_NAME)),
-                                        m_spFactory(nullptr)
+                                        m_spFactory(nullptr),
+                                        m_watchdogInstalled(false)
 {
     // Sets default dirs
     setScriptsDir("scripts");
     setLogsDir("logs");
     setDllsDir("dlls");
+    setConfigsDir("configs");
 
     // Initialize SourcePawn library
     _initSourcePawn();
@@ -72,6 +77,29 @@ void SPGlobal::setDllsDir(std::string_view folder)
     m_SPModDllsDir = m_SPModDir / folder.data();
 }
 
+void SPGlobal::setConfigsDir(std::string_view folder)
+{
+    m_SPModConfigsDir = m_SPModDir / folder.data();
+}
+
+void SPGlobal::installWatchdog()
+{
+    // Watchdog can be installed only once, timeout changes take effect after restart
+    if (m_watchdogInstalled)
+        return;
+
+    auto timeout = static_cast<int>(gCvarWatchdogTimeout.value);
+    if (timeout <= 0)
+        return;
+
+    m_watchdogInstalled = getSPEnvironment()->APIv2()->InstallWatchdogTimer(timeout);
+
+    if (m_watchdogInstalled)
+        m_loggingSystem->LogMessageCore("Watchdog installed, plugins calls are limited to ", timeout, " ms");
+    else
+        m_loggingSystem->LogErrorCore("Could not install watchdog");
+}
+
 void SPGlobal::_initSourcePawn()
 {
     fs::path SPDir(getDllsDirCore());
@@ -171,6 +199,16 @@ IPlayerMngr *SPGlobal::getPlayerManager() const
     return m_plrManager.get();
 }
 
+IMessageMngr *SPGlobal::getMessageManager() const
+{
+    return m_msgManager.get();
+}
+
+IPrintMngr *SPGlobal::getPrintManager() const
+{
+    return m_printManager.get();
+}
+
 IUtils *SPGlobal::getUtils() const
 {
     return m_utils.get();
@@ -55,6 +55,8 @@ public:
     ITimerMngr *getTimerManager() const override;
     IMenuMngr *getMenuManager() const override;
     IPlayerMngr *getPlayerManager() const override;
+    IMessageMngr *getMessageManager() const override;
+    IPrintMngr *getPrintManager() const override;
     IUtils *getUtils() const override;
 
     unsigned int formatString(char *buffer,
@@ -101,6 +103,18 @@ public:
     {
         return m_utils;
     }
+    const auto &getProfilerCore() const
+    {
+        return m_profiler;
+    }
+    const auto &getMessageManagerCore() const
+    {
+        return m_msgManager;
+    }
+    const auto &getPrintManagerCore() const
+    {
+        return m_printManager;
+    }
     const std::unique_ptr<PlayerMngr> &getPlayerManagerCore() const
     {
         return m_plrManager;
@@ -117,10 +131,16 @@ public:
     {
         return m_SPModDllsDir;
     }
+    const auto &getConfigsDirCore() const
+    {
+        return m_SPModConfigsDir;
+    }
 
     void setScriptsDir(std::string_view folder);
     void setLogsDir(std::string_view folder);
     void setDllsDir(std::string_view folder);
+    void setConfigsDir(std::string_view folder);
+    void installWatchdog();
 
 private:
     void _initSourcePawn();
@@ -129,6 +149,7 @@ private:
     fs::path m_SPModDir;
     fs::path m_SPModLogsDir;
     fs::path m_SPModDllsDir;
+    fs::path m_SPModConfigsDir;
     std::unique_ptr<NativeMngr> m_nativeManager;
     std::unique_ptr<PluginMngr> m_pluginManager;
     std::unique_ptr<ForwardMngr> m_forwardManager;
@@ -139,8 +160,12 @@ private:
     std::unique_ptr<MenuMngr> m_menuManager;
     std::unique_ptr<PlayerMngr> m_plrManager;
     std::unique_ptr<Utils> m_utils;
+    std::unique_ptr<Profiler> m_profiler;
+    std::unique_ptr<MessageMngr> m_msgManager;
+    std::unique_ptr<PrintMngr> m_printManager;
     std::string m_modName;
     SourcePawn::ISourcePawnFactory *m_spFactory;
+    bool m_watchdogInstalled;
 
     // SourcePawn library handle
 #ifdef SP_POSIX
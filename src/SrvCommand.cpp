@@ -30,6 +30,8 @@ void SPModInfoCommand()
         msg << "Command:\n";
         msg << "version - displays currently version\n";
         msg << "plugins - displays currently loaded plugins\n";
+        msg << "profile [on|off|reset|snapshot] - controls plugins profiling\n";
+        msg << "profile natives [on|off|snapshot] - controls natives profiling\n";
         msg << "gpl - displays spmod license";
 
         logSystem->LogConsoleCore(msg.str());
@@ -54,21 +56,81 @@ void SPModInfoCommand()
                                       "version",
                                        std::setw(authWidth),
                                       "author",
-                                      "filename");
+                                      std::setw(fileWidth),
+                                      "filename",
+                                      "status");
             std::size_t pos = 1;
-            for (auto entry : gSPGlobal->getPluginManagerCore()->getPluginsList())
+            for (const auto &plugin : gSPGlobal->getPluginManagerCore()->getPluginsList())
             {
+                std::string status;
+                if (plugin->isPaused())
+                    status = "paused";
+                else if (std::size_t disabledNum = plugin->getDisabledFunctionsNum(); disabledNum)
+                    status = "running (" + std::to_string(disabledNum) + " disabled functions)";
+                else
+                    status = "running";
+
                 logSystem->LogConsoleCore("[", std::right, std::setw(3), pos++, "] ", // right align for ordinal number
                                         std::left, // left align for the rest
                                         std::setw(nameWidth), // format rules for name
-                                        entry.second->getNameCore().substr(0, nameWidth - 1),
+                                        plugin->getNameCore().substr(0, nameWidth - 1),
                                         std::setw(verWidth), // format rules for version
-                                        entry.second->getVersionCore().substr(0, verWidth - 1),
+                                        plugin->getVersionCore().substr(0, verWidth - 1),
                                         std::setw(authWidth), // format rules for author
-                                        entry.second->getAuthorCore().substr(0, authWidth - 1),
-                                        entry.second->getFileNameCore().substr(0, fileWidth));
+                                        plugin->getAuthorCore().substr(0, authWidth - 1),
+                                        std::setw(fileWidth), // format rules for filename
+                                        plugin->getFileNameCore().substr(0, fileWidth - 1),
+                                        status);
             }
         }
+        else if (arg == "profile")
+        {
+            const std::unique_ptr<Profiler> &profiler = gSPGlobal->getProfilerCore();
+            std::string_view action = (CMD_ARGC() > 2) ? CMD_ARGV(2) : "snapshot";
+
+            if (action == "on")
+            {
+                profiler->setEnabled(true);
+                logSystem->LogConsoleCore("Profiling enabled");
+            }
+            else if (action == "off")
+            {
+                profiler->setEnabled(false);
+                logSystem->LogConsoleCore("Profiling disabled");
+            }
+            else if (action == "reset")
+            {
+                profiler->resetStats();
+                logSystem->LogConsoleCore("Profiling counters have been reset");
+            }
+            else if (action == "natives")
+            {
+                const std::unique_ptr<NativeMngr> &nativeMngr = gSPGlobal->getNativeManagerCore();
+                std::string_view nativesAction = (CMD_ARGC() > 3) ? CMD_ARGV(3) : "snapshot";
+
+                if (nativesAction == "on" || nativesAction == "off")
+                {
+                    nativeMngr->setProfiling(nativesAction == "on");
+                    logSystem->LogConsoleCore("Natives profiling ", nativeMngr->isProfiling() ? "enabled" : "disabled");
+                }
+                else
+                {
+                    if (!nativeMngr->isProfiling())
+                        logSystem->LogConsoleCore("Natives profiling is disabled, use \"spmod profile natives on\" to enable it");
+
+                    profiler->printNativesSnapshot();
+                }
+            }
+            else if (action == "snapshot")
+            {
+                if (!Profiler::isEnabled())
+                    logSystem->LogConsoleCore("Profiling is disabled, use \"spmod profile on\" to enable it");
+
+                profiler->printSnapshot();
+            }
+            else
+                logSystem->LogConsoleCore("Usage: spmod profile [on|off|reset|snapshot|natives [on|off|snapshot]]");
+        }
         else if (arg == "gpl")
         {
             logSystem->LogConsoleCore("   SPMod - SourcePawn Scripting Engine for Half-Life\n \
@@ -106,8 +168,16 @@ void PluginSrvCmd()
         {
             cell_t result;
             SourcePawn::IPluginFunction *func = cmd->getFunc();
+
+            // Plugin has been paused
+            if (!func->IsRunnable())
+                break;
+
             func->PushCell(cmd->getId());
-            func->Execute(&result);
+            {
+                Profiler::Scope profile(func, Profiler::Source::Command);
+                func->Execute(&result);
+            }
             break;
         }
     }
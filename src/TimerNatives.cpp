@@ -38,7 +38,7 @@ static cell_t TimerCtor(SourcePawn::IPluginContext *ctx,
     }
 
     if (params[arg_exec])
-        timerMngr->execTimerCore(timer);
+        timerMngr->execTimerCore(timer.get());
 
     return timer->getId();
 }
@@ -48,7 +48,7 @@ static cell_t PauseGet(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_id = 1 };
     const std::unique_ptr<TimerMngr> &timerMngr = gSPGlobal->getTimerManagerCore();
-    std::shared_ptr<Timer> timer = timerMngr->getTimer(params[arg_id]);
+    Timer *timer = timerMngr->getTimer(params[arg_id]);
 
     if (!timer)
     {
@@ -64,7 +64,7 @@ static cell_t IntervalGet(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_id = 1 };
     const std::unique_ptr<TimerMngr> &timerMngr = gSPGlobal->getTimerManagerCore();
-    std::shared_ptr<Timer> timer = timerMngr->getTimer(params[arg_id]);
+    Timer *timer = timerMngr->getTimer(params[arg_id]);
 
     if (!timer)
     {
@@ -80,7 +80,7 @@ static cell_t PauseSet(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_id = 1, arg_pause };
     const std::unique_ptr<TimerMngr> &timerMngr = gSPGlobal->getTimerManagerCore();
-    std::shared_ptr<Timer> timer = timerMngr->getTimer(params[arg_id]);
+    Timer *timer = timerMngr->getTimer(params[arg_id]);
 
     if (!timer)
     {
@@ -97,7 +97,7 @@ static cell_t IntervalSet(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_id = 1, arg_interval };
     const std::unique_ptr<TimerMngr> &timerMngr = gSPGlobal->getTimerManagerCore();
-    std::shared_ptr<Timer> timer = timerMngr->getTimer(params[arg_id]);
+    Timer *timer = timerMngr->getTimer(params[arg_id]);
 
     if (!timer)
     {
@@ -121,7 +121,7 @@ static cell_t Trigger(SourcePawn::IPluginContext *ctx,
 {
     enum { arg_id = 1 };
     const std::unique_ptr<TimerMngr> &timerMngr = gSPGlobal->getTimerManagerCore();
-    std::shared_ptr<Timer> timer = timerMngr->getTimer(params[arg_id]);
+    Timer *timer = timerMngr->getTimer(params[arg_id]);
 
     if (!timer)
     {
@@ -32,6 +32,13 @@ Timer::Timer(std::size_t id,
 {
     if (m_interval <= 0.0f)
         throw std::runtime_error("Interval lesser or equal to 0");
+
+    // Owner of plugin callback is looked up once, timers are cleared together with plugins
+    if (auto *const *pluginFunc = std::get_if<SourcePawn::IPluginFunction *>(&m_callback); pluginFunc)
+    {
+        SourcePawn::IPluginContext *ctx = (*pluginFunc)->GetParentRuntime()->GetDefaultContext();
+        m_plugin = gSPGlobal->getPluginManagerCore()->getPluginCore(ctx).get();
+    }
 }
 
 float Timer::getInterval() const
@@ -70,9 +77,21 @@ bool Timer::exec(float gltime)
     {
         cell_t result;
         auto *func = std::get<SourcePawn::IPluginFunction *>(m_callback);
+
+        // Plugin has been paused, keep timer until it is resumed
+        if (!func->IsRunnable())
+            return true;
+
+        // Callback keeps throwing errors, skip it until its cooldown passes
+        if (m_plugin && m_plugin->isFunctionDisabled(func))
+            return true;
+
         func->PushCell(m_id);
         func->PushCell(std::get<cell_t>(m_data));
-        func->Execute(&result);
+        {
+            Profiler::Scope profile(func, Profiler::Source::Timer);
+            func->Execute(&result);
+        }
 
         return result == IForward::ReturnValue::PluginIgnored;
     }
@@ -105,7 +124,7 @@ void TimerMngr::removeTimer(ITimer *timer)
     {
         if (iter->get() == timer)
         {
-            m_timers.erase(iter);
+            _removeTimer(iter);
             break;
         }
         ++iter;
@@ -119,23 +138,19 @@ void TimerMngr::removeTimerCore(std::size_t id)
     {
         if ((*iter)->getId() == id)
         {
-            m_timers.erase(iter);
+            _removeTimer(iter);
             break;
         }
         ++iter;
     }
 }
 
-std::shared_ptr<Timer> TimerMngr::getTimer(std::size_t id) const
+Timer *TimerMngr::getTimer(std::size_t id) const
 {
-    auto iter = m_timers.begin();
-    while (iter != m_timers.end())
+    for (const auto &timer : m_timers)
     {
-        if ((*iter)->getId() == id)
-        {
-            return *iter;
-        }
-        ++iter;
+        if (timer->getId() == id && !timer->m_removed)
+            return timer.get();
     }
 
     return nullptr;
@@ -143,66 +158,61 @@ std::shared_ptr<Timer> TimerMngr::getTimer(std::size_t id) const
 
 void TimerMngr::execTimers(float gltime)
 {
-    auto iter = m_timers.begin();
-    while (iter != m_timers.end())
+    m_executing = true;
+
+    // Callbacks may create new timers, so index is used as iterators could be invalidated
+    for (std::size_t i = 0; i < m_timers.size(); ++i)
     {
-        std::shared_ptr<Timer> task = *iter;
+        Timer *task = m_timers[i].get();
 
-        if (task->isPaused() || task->m_lastExec + task->m_interval > gltime)
-        {
-            ++iter;
+        if (task->m_removed || task->isPaused() || task->m_lastExec + task->m_interval > gltime)
             continue;
-        }
 
         if (!task->exec(gltime))
-            iter = m_timers.erase(iter);
-        else
-            ++iter;
+            task->m_removed = true;
     }
-}
 
-void TimerMngr::execTimerCore(std::shared_ptr<Timer> timer)
-{
-    auto iter = m_timers.begin();
-    float curTime = gpGlobals->time;
-    while (iter != m_timers.end())
+    m_executing = false;
+
+    m_timers.erase(std::remove_if(m_timers.begin(), m_timers.end(), [](const std::shared_ptr<Timer> &timer)
     {
-        std::shared_ptr<Timer> task = *iter;
+        return timer->m_removed;
+    }), m_timers.end());
+}
 
-        if (task != timer)
-        {
-            ++iter;
-            continue;
-        }
+void TimerMngr::execTimerCore(Timer *timer)
+{
+    if (timer->m_removed)
+        return;
 
-        if (!task->exec(curTime))
-            m_timers.erase(iter);
+    // Callback could have freed the timer and a new one could have taken its address, look it up by id
+    std::size_t id = timer->getId();
+    if (timer->exec(gpGlobals->time))
+        return;
 
-        break;
-    }
+    removeTimerCore(id);
 }
 
 void TimerMngr::execTimer(ITimer *timer)
 {
-    auto iter = m_timers.begin();
-    float curTime = gpGlobals->time;
-    while (iter != m_timers.end())
+    for (const auto &task : m_timers)
     {
-        std::shared_ptr<Timer> task = *iter;
-
-        if (task.get() != timer)
+        if (task.get() == timer)
         {
-            ++iter;
-            continue;
+            execTimerCore(task.get());
+            break;
         }
-
-        if (!task->exec(curTime))
-            m_timers.erase(iter);
-        
-        break;
     }
 }
 
+void TimerMngr::_removeTimer(std::vector<std::shared_ptr<Timer>>::iterator iter)
+{
+    if (m_executing)
+        (*iter)->m_removed = true;
+    else
+        m_timers.erase(iter);
+}
+
 void TimerMngr::clearTimers()
 {
     m_timers.clear();
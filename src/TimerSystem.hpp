@@ -42,28 +42,31 @@ public:
 
     void removeTimer(ITimer *timer) override;
     void execTimer(ITimer *timer) override;
-    std::shared_ptr<Timer> getTimer(std::size_t id) const;
+    Timer *getTimer(std::size_t id) const;
     void execTimers(float time);
     void clearTimers();
-    void execTimerCore(std::shared_ptr<Timer> timer);
+    void execTimerCore(Timer *timer);
     void removeTimerCore(std::size_t id);
 
     /* next execution of timers */
     static inline float m_nextExecution;
 
 private:
+    void _removeTimer(std::vector<std::shared_ptr<Timer>>::iterator iter);
+
     /* keeps track of timers ids */
     std::size_t m_id;
 
+    /* set while timers are executed, removals are deferred so callbacks can't free running timer */
+    bool m_executing = false;
+
     std::vector<std::shared_ptr<Timer>> m_timers;
 };
 
 class Timer final : public ITimer
 {
 public:
-    friend void TimerMngr::execTimers(float);
-    friend void TimerMngr::execTimerCore(std::shared_ptr<Timer>);
-    friend void TimerMngr::execTimer(ITimer *);
+    friend class TimerMngr;
 
     Timer() = delete;
     ~Timer() = default;
@@ -96,9 +99,15 @@ private:
     /* callback data */
     std::variant<cell_t, void *> m_data;
 
+    /* owner of plugin callback, nullptr for module timers */
+    Plugin *m_plugin = nullptr;
+
     /* Pause state */
     bool m_paused;
 
     /* last execution */
     float m_lastExec;
+
+    /* removed while timers were executed, erased once they finish */
+    bool m_removed = false;
 };
\ No newline at end of file
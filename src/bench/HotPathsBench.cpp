@@ -0,0 +1,271 @@
+/*  SPMod - SourcePawn Scripting Engine for Half-Life
+ *  Copyright (C) 2018  SPMod Development Team
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Microbenchmark of the per-player hot paths: connect, menu display and menuselect.
+// Engine and Metamod are replaced by no-op stubs, so the numbers cover SPMod code only.
+// Run it on the same machine before and after a change to compare them.
+
+#include <spmod.hpp>
+#include <iostream>
+
+extern DLL_FUNCTIONS gDllFunctionTable;
+extern DLL_FUNCTIONS gDllFunctionTablePost;
+extern meta_globals_t *gpMetaGlobals;
+extern mutil_funcs_t *gpMetaUtilFuncs;
+
+namespace
+{
+    constexpr int maxClients = 32;
+    constexpr int iterations = 200000;
+
+    // Exit code which meson treats as a skipped benchmark
+    constexpr int benchSkipped = 77;
+
+    edict_t gEdicts[maxClients + 1];
+    globalvars_t gGlobals;
+    meta_globals_t gMetaGlobals;
+    mutil_funcs_t gMetaUtilFuncs;
+
+    int stubIndexOfEdict(const edict_t *edict)
+    {
+        return static_cast<int>(edict - gEdicts);
+    }
+
+    edict_t *stubPEntityOfEntIndex(int index)
+    {
+        return gEdicts + index;
+    }
+
+    int stubGetPlayerUserId(edict_t *edict)
+    {
+        return stubIndexOfEdict(edict);
+    }
+
+    const char *stubGetPlayerAuthId(edict_t *edict [[maybe_unused]])
+    {
+        return "STEAM_0:0:123";
+    }
+
+    const char *stubCmd_Argv(int argc)
+    {
+        return argc ? "1" : "menuselect";
+    }
+
+    int stubCmd_Argc()
+    {
+        return 2;
+    }
+
+    char *stubGetInfoKeyBuffer(edict_t *edict [[maybe_unused]])
+    {
+        static char infobuffer[] = "";
+        return infobuffer;
+    }
+
+    void stubMessageBegin(int msg_dest [[maybe_unused]],
+                          int msg_type [[maybe_unused]],
+                          const float *pOrigin [[maybe_unused]],
+                          edict_t *ed [[maybe_unused]])
+    {
+    }
+
+    void stubMessageEnd() {}
+    void stubWriteInt(int value [[maybe_unused]]) {}
+    void stubWriteFloat(float value [[maybe_unused]]) {}
+    void stubWriteString(const char *value [[maybe_unused]]) {}
+    void stubServerPrint(const char *msg [[maybe_unused]]) {}
+
+    void stubClientPrintf(edict_t *edict [[maybe_unused]],
+                          PRINT_TYPE type [[maybe_unused]],
+                          const char *msg [[maybe_unused]])
+    {
+    }
+
+    const char *stubGetGameInfo(plid_t plid [[maybe_unused]],
+                                ginfo_t tag [[maybe_unused]])
+    {
+        return "valve";
+    }
+
+    const char *stubGetUserMsgName(plid_t plid [[maybe_unused]],
+                                   int msgid [[maybe_unused]],
+                                   int *size [[maybe_unused]])
+    {
+        return nullptr;
+    }
+
+    void installStubs()
+    {
+        enginefuncs_t engfuncs = {};
+
+        engfuncs.pfnIndexOfEdict = stubIndexOfEdict;
+        engfuncs.pfnPEntityOfEntIndex = stubPEntityOfEntIndex;
+        engfuncs.pfnGetPlayerUserId = stubGetPlayerUserId;
+        engfuncs.pfnGetPlayerAuthId = stubGetPlayerAuthId;
+        engfuncs.pfnCmd_Argv = stubCmd_Argv;
+        engfuncs.pfnCmd_Argc = stubCmd_Argc;
+        engfuncs.pfnGetInfoKeyBuffer = stubGetInfoKeyBuffer;
+        engfuncs.pfnMessageBegin = stubMessageBegin;
+        engfuncs.pfnMessageEnd = stubMessageEnd;
+        engfuncs.pfnWriteByte = stubWriteInt;
+        engfuncs.pfnWriteChar = stubWriteInt;
+        engfuncs.pfnWriteShort = stubWriteInt;
+        engfuncs.pfnWriteLong = stubWriteInt;
+        engfuncs.pfnWriteAngle = stubWriteFloat;
+        engfuncs.pfnWriteCoord = stubWriteFloat;
+        engfuncs.pfnWriteString = stubWriteString;
+        engfuncs.pfnWriteEntity = stubWriteInt;
+        engfuncs.pfnServerPrint = stubServerPrint;
+        engfuncs.pfnClientPrintf = stubClientPrintf;
+
+        GiveFnptrsToDll(&engfuncs, &gGlobals);
+
+        gMetaUtilFuncs.pfnGetGameInfo = stubGetGameInfo;
+        gMetaUtilFuncs.pfnGetUserMsgName = stubGetUserMsgName;
+
+        gpMetaGlobals = &gMetaGlobals;
+        gpMetaUtilFuncs = &gMetaUtilFuncs;
+    }
+
+    template<typename T>
+    void measure(const char *name,
+                 T &&func)
+    {
+        // Warm up caches and lazily built state before timing
+        for (int i = 0; i < iterations / 10; i++)
+            func();
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < iterations; i++)
+            func();
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        auto nsPerOp = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+
+        std::cout << std::left << std::setw(32) << name << std::fixed << std::setprecision(1)
+                  << nsPerOp << " ns/op" << std::endl;
+    }
+
+    void itemHandler(IMenu *const menu [[maybe_unused]],
+                     IMenuItem *const item [[maybe_unused]],
+                     IPlayer *const player [[maybe_unused]])
+    {
+    }
+
+    ItemStatus itemCallback(IMenu *const menu [[maybe_unused]],
+                            IMenuItem *const item [[maybe_unused]],
+                            IPlayer *const player [[maybe_unused]])
+    {
+        return ItemStatus::Enabled;
+    }
+
+    std::shared_ptr<Menu> createMenu(IMenu::MenuItemCallback callback)
+    {
+        const std::unique_ptr<MenuMngr> &menuMngr = gSPGlobal->getMenuManagerCore();
+        std::shared_ptr<Menu> menu = menuMngr->registerMenuCore(itemHandler, MenuStyle::Item, true);
+
+        menu->setTitle("Benchmark menu");
+        for (int i = 0; i < 20; i++)
+        {
+            std::string name("Item ");
+            name += std::to_string(i + 1);
+            menu->appendItem(name.c_str(), callback, nullptr);
+        }
+
+        return menu;
+    }
+}
+
+int main(int argc,
+         char *argv[])
+{
+    const char *spmodDir = argc > 1 ? argv[1] : std::getenv("SPMOD_DIR");
+    if (!spmodDir)
+    {
+        std::cerr << "Usage: spmod_bench <spmod dir with dlls/" << SPGlobal::sourcepawnLibrary << ">" << std::endl;
+        return benchSkipped;
+    }
+
+    installStubs();
+
+    // Has to be created before global object
+    gSPModModuleDef = std::make_unique<SPModModule>();
+
+    try
+    {
+        gSPGlobal = std::make_unique<SPGlobal>(fs::path(spmodDir) / "dlls" / "spmod_mm_i386.so");
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return benchSkipped;
+    }
+
+    const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
+    const std::unique_ptr<ForwardMngr> &fwdMngr = gSPGlobal->getForwardManagerCore();
+    const std::unique_ptr<MenuMngr> &menuMngr = gSPGlobal->getMenuManagerCore();
+
+    // Same setup as ServerActivatePost, without plugins and ReHLDS hooks
+    plrMngr->ServerActivatePost(gEdicts, maxClients);
+    fwdMngr->addDefaultsForwards();
+    gmsgShowMenu = 96;
+
+    edict_t *edict = gEdicts + 1;
+    char rejectReason[128] = {};
+
+    measure("ClientConnect + drop", [&]()
+    {
+        gDllFunctionTable.pfnClientConnect(edict, "Player", "127.0.0.1:27005", rejectReason);
+        gDllFunctionTablePost.pfnClientConnect(edict, "Player", "127.0.0.1:27005", rejectReason);
+        gDllFunctionTablePost.pfnClientPutInServer(edict);
+
+        PlayerMngr::m_playersNum--;
+        plrMngr->getPlayerCore(edict)->disconnect();
+        plrMngr->SV_DropClientPost(edict);
+    });
+
+    // Keep one player in game for the menu paths
+    gDllFunctionTable.pfnClientConnect(edict, "Player", "127.0.0.1:27005", rejectReason);
+    gDllFunctionTablePost.pfnClientConnect(edict, "Player", "127.0.0.1:27005", rejectReason);
+    gDllFunctionTablePost.pfnClientPutInServer(edict);
+
+    Player *player = plrMngr->getPlayerCore(edict);
+    std::shared_ptr<Menu> cachedMenu = createMenu(nullptr);
+    std::shared_ptr<Menu> callbackMenu = createMenu(itemCallback);
+
+    measure("Menu display (cached)", [&]()
+    {
+        menuMngr->displayMenu(cachedMenu, player, 0, -1);
+    });
+
+    measure("Menu display (callbacks)", [&]()
+    {
+        menuMngr->displayMenu(callbackMenu, player, 0, -1);
+    });
+
+    measure("Menu display + menuselect", [&]()
+    {
+        menuMngr->displayMenu(cachedMenu, player, 0, -1);
+        gDllFunctionTable.pfnClientCommand(edict);
+    });
+
+    menuMngr->clearMenus();
+    fwdMngr->clearForwards();
+
+    return 0;
+}
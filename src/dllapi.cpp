@@ -17,6 +17,21 @@
 
 #include "spmod.hpp"
 
+// Time limit in ms for a single call into plugins, 0 disables watchdog
+cvar_t gCvarWatchdogTimeout = { "spmod_watchdog_timeout", const_cast<char *>("0"), FCVAR_EXTDLL, 0.0f, nullptr };
+
+// Number of watchdog timeouts after which plugin gets paused, 0 never pauses
+cvar_t gCvarWatchdogStrikes = { "spmod_watchdog_strikes", const_cast<char *>("3"), FCVAR_EXTDLL, 0.0f, nullptr };
+
+// Number of errors within window after which plugin function gets disabled, 0 disables breaker
+cvar_t gCvarBreakerErrors = { "spmod_breaker_errors", const_cast<char *>("5"), FCVAR_EXTDLL, 0.0f, nullptr };
+
+// Time window in seconds in which errors are counted
+cvar_t gCvarBreakerWindow = { "spmod_breaker_window", const_cast<char *>("10"), FCVAR_EXTDLL, 0.0f, nullptr };
+
+// Time in seconds for which function stays disabled
+cvar_t gCvarBreakerCooldown = { "spmod_breaker_cooldown", const_cast<char *>("60"), FCVAR_EXTDLL, 0.0f, nullptr };
+
 static qboolean ClientConnect(edict_t *pEntity,
                               const char *pszName,
                               const char *pszAddress,
@@ -31,7 +46,7 @@ static qboolean ClientConnect(edict_t *pEntity,
         RETURN_META_VALUE(MRES_SUPERCEDE, FALSE);
 
     cell_t result;
-    std::shared_ptr<Forward> forward = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientConnect);
+    Forward *forward = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientConnect);
 
     forward->pushCell(plrMngr->getPlayerCore(pEntity)->getIndex());
     forward->pushString(pszName);
@@ -51,7 +66,7 @@ static void ClientCommand(edict_t *pEntity)
 
     {
         cell_t result;
-        std::shared_ptr<Forward> fwdCmd = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientCommmand);
+        Forward *fwdCmd = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientCommmand);
 
         if (!fwdCmd)
             RETURN_META(MRES_IGNORED);
@@ -83,9 +98,17 @@ static void ClientCommand(edict_t *pEntity)
             {
                 cell_t result;
                 SourcePawn::IPluginFunction *func = cmd->getFunc();
+
+                // Plugin has been paused
+                if (!func->IsRunnable())
+                    continue;
+
                 func->PushCell(ENTINDEX(pEntity));
                 func->PushCell(cmd->getId());
-                func->Execute(&result);
+                {
+                    Profiler::Scope profile(func, Profiler::Source::Command);
+                    func->Execute(&result);
+                }
 
                 if (result == IForward::ReturnValue::PluginStop || result == IForward::ReturnValue::PluginHandled)
                 {
@@ -167,6 +190,9 @@ static void ServerActivatePost(edict_t *pEdictList,
 
     gSPGlobal->getForwardManagerCore()->addDefaultsForwards();
 
+    // Configs are executed by now, so watchdog timeout is known
+    gSPGlobal->installWatchdog();
+
     const std::unique_ptr<PluginMngr> &pluginManager = gSPGlobal->getPluginManagerCore();
     pluginManager->setPluginPrecache(true);
     pluginManager->loadPlugins();
@@ -186,16 +212,27 @@ static void ServerDeactivatePost()
     gSPGlobal->getTimerManagerCore()->clearTimers();
     gSPGlobal->getCommandManagerCore()->clearCommands();
     gSPGlobal->getCvarManagerCore()->clearCvarsCallback();
+    gSPGlobal->getPlayerManagerCore()->clearUserInfoHooks();
+    gSPGlobal->getMessageManagerCore()->clearHooks();
+    gSPGlobal->getMessageManagerCore()->clearTemplates();
+    gSPGlobal->getPrintManagerCore()->clearQueues();
     gSPGlobal->getMenuManagerCore()->clearMenus();
     fwdMngr->clearForwards();
     gSPGlobal->getLoggerCore()->resetErrorState();
     gSPGlobal->getNativeManagerCore()->freeFakeNatives();
+    gSPGlobal->getProfilerCore()->resetStats();
     uninstallRehldsHooks();
 }
 
 static void GameInitPost()
 {
     REG_SVR_COMMAND("spmod", SPModInfoCommand);
+
+    CVAR_REGISTER(&gCvarWatchdogTimeout);
+    CVAR_REGISTER(&gCvarWatchdogStrikes);
+    CVAR_REGISTER(&gCvarBreakerErrors);
+    CVAR_REGISTER(&gCvarBreakerWindow);
+    CVAR_REGISTER(&gCvarBreakerCooldown);
 }
 
 static qboolean ClientConnectPost(edict_t *pEntity,
@@ -217,7 +254,7 @@ static void ClientPutInServerPost(edict_t *pEntity)
     const std::unique_ptr<PlayerMngr> &plrMngr = gSPGlobal->getPlayerManagerCore();
     plrMngr->ClientPutInServerPost(pEntity);
 
-    std::shared_ptr<Forward> forward = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientPutInServer);
+    Forward *forward = gSPGlobal->getForwardManagerCore()->getDefaultForward(def::ClientPutInServer);
     forward->pushCell(plrMngr->getPlayerCore(pEntity)->getIndex());
     forward->execFunc(nullptr);
 }
@@ -231,6 +268,8 @@ static void ClientUserInfoChangedPost(edict_t *pEntity,
 static void StartFramePost()
 {
     gSPGlobal->getPlayerManagerCore()->StartFramePost();
+    gSPGlobal->getMenuManagerCore()->StartFramePost();
+    gSPGlobal->getCvarManagerCore()->runDeferredCallbacks();
 
     if (TimerMngr::m_nextExecution <= gpGlobals->time)
     {
@@ -238,6 +277,9 @@ static void StartFramePost()
         gSPGlobal->getTimerManagerCore()->execTimers(gpGlobals->time);
     }
 
+    // Last, so text printed by timers goes out in this frame
+    gSPGlobal->getPrintManagerCore()->flush();
+
     RETURN_META(MRES_IGNORED);
 }
 
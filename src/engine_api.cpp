@@ -22,7 +22,7 @@ static void ChangeLevel(const char *s1,
 {
     using def = ForwardMngr::FwdDefault;
     const std::unique_ptr<ForwardMngr> &fwdMngr = gSPGlobal->getForwardManagerCore();
-    std::shared_ptr<Forward> fwdMapChange = fwdMngr->getDefaultForward(def::MapChange);
+    Forward *fwdMapChange = fwdMngr->getDefaultForward(def::MapChange);
     cell_t result;
 
     fwdMapChange->pushString(s1);
@@ -34,17 +34,62 @@ static void ChangeLevel(const char *s1,
     RETURN_META(MRES_IGNORED);
 }
 
-static void MessageBegin_Pre(int msg_dest [[maybe_unused]],
+static void MessageBegin_Pre(int msg_dest,
                              int msg_type,
-                             const float *pOrigin [[maybe_unused]],
+                             const float *pOrigin,
                              edict_t *ed)
 {
     if(msg_type == gmsgShowMenu || msg_type == gmsgVGUIMenu)
     {
-        std::shared_ptr<Player> pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(ed);
+        Player *pPlayer = gSPGlobal->getPlayerManagerCore()->getPlayerCore(ed);
         gSPGlobal->getMenuManagerCore()->closeMenu(pPlayer);
     }
-    RETURN_META(MRES_IGNORED);
+    RETURN_META(gSPGlobal->getMessageManagerCore()->MessageBegin(msg_dest, msg_type, pOrigin, ed));
+}
+
+static void MessageEnd_Pre()
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->MessageEnd());
+}
+
+static void WriteByte_Pre(int iValue)
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->WriteInt(MessageMngr::ParamType::Byte, iValue));
+}
+
+static void WriteChar_Pre(int iValue)
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->WriteInt(MessageMngr::ParamType::Char, iValue));
+}
+
+static void WriteShort_Pre(int iValue)
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->WriteInt(MessageMngr::ParamType::Short, iValue));
+}
+
+static void WriteLong_Pre(int iValue)
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->WriteInt(MessageMngr::ParamType::Long, iValue));
+}
+
+static void WriteAngle_Pre(float flValue)
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->WriteFloat(MessageMngr::ParamType::Angle, flValue));
+}
+
+static void WriteCoord_Pre(float flValue)
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->WriteFloat(MessageMngr::ParamType::Coord, flValue));
+}
+
+static void WriteString_Pre(const char *sz)
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->WriteString(sz));
+}
+
+static void WriteEntity_Pre(int iValue)
+{
+    RETURN_META(gSPGlobal->getMessageManagerCore()->WriteInt(MessageMngr::ParamType::Entity, iValue));
 }
 
 enginefuncs_t gEngineFunctionsTable =
@@ -96,15 +141,15 @@ enginefuncs_t gEngineFunctionsTable =
     nullptr,		// pfnDecalIndex()
     nullptr,		// pfnPointContents()
     MessageBegin_Pre, // pfnMessageBegin()
-    nullptr,		// pfnMessageEnd()
-    nullptr,		// pfnWriteByte()
-    nullptr,		// pfnWriteChar()
-    nullptr,		// pfnWriteShort()
-    nullptr,		// pfnWriteLong()
-    nullptr,		// pfnWriteAngle()
-    nullptr,		// pfnWriteCoord()
-    nullptr,		// pfnWriteString()
-    nullptr,		// pfnWriteEntity()
+    MessageEnd_Pre, // pfnMessageEnd()
+    WriteByte_Pre,  // pfnWriteByte()
+    WriteChar_Pre,  // pfnWriteChar()
+    WriteShort_Pre, // pfnWriteShort()
+    WriteLong_Pre,  // pfnWriteLong()
+    WriteAngle_Pre, // pfnWriteAngle()
+    WriteCoord_Pre, // pfnWriteCoord()
+    WriteString_Pre, // pfnWriteString()
+    WriteEntity_Pre, // pfnWriteEntity()
     nullptr,		// pfnCVarRegister()
     nullptr,		// pfnCVarGetFloat()
     nullptr,		// pfnCVarGetString()
@@ -220,8 +265,10 @@ enginefuncs_t gEngineFunctionsTable =
 };
 
 static int RegUserMsg_Post(const char *pszName,
-                           int iSize [[maybe_unused]])
+                           int iSize)
 {
+    gSPGlobal->getMessageManagerCore()->registerUserMsgCore(META_RESULT_ORIG_RET(int), pszName, iSize);
+
     if(!strcmp(pszName, "ShowMenu"))
     {
         gmsgShowMenu = META_RESULT_ORIG_RET(int);
@@ -229,6 +276,10 @@ static int RegUserMsg_Post(const char *pszName,
     else if(!strcmp(pszName, "VGUIMenu"))
     {
         gmsgVGUIMenu = META_RESULT_ORIG_RET(int);
+    }
+    else if(!strcmp(pszName, "TextMsg"))
+    {
+        gmsgTextMsg = META_RESULT_ORIG_RET(int);
     }
      RETURN_META_VALUE(MRES_IGNORED, 0);
 }
@@ -52,7 +52,10 @@
 
 // STL C++
 #include <memory>
+#include <algorithm>
 #include <vector>
+#include <deque>
+#include <queue>
 #include <sstream>
 #include <unordered_map>
 #include <exception>
@@ -61,6 +64,14 @@
 #include <string_view>
 #include <fstream>
 #include <regex>
+#include <chrono>
+#include <iomanip>
+#include <cmath>
+#include <limits>
+
+#if __has_include(<charconv>)
+    #include <charconv>
+#endif
 
 #if __has_include(<filesystem>)
     #include <filesystem>
@@ -110,6 +121,9 @@ using namespace SPMod;
 #include "TimerSystem.hpp"
 #include "MenuSystem.hpp"
 #include "PlayerSystem.hpp"
+#include "MessageSystem.hpp"
+#include "PrintSystem.hpp"
+#include "ProfilerSystem.hpp"
 #include "SPGlobal.hpp"
 
 constexpr auto gSPModAuthor = "SPMod Development Team";
@@ -129,6 +143,14 @@ extern sp_nativeinfo_t gPlayerNatives[];
 
 extern int gmsgShowMenu;
 extern int gmsgVGUIMenu;
+extern int gmsgTextMsg;
+
+// Core cvars (dllapi.cpp)
+extern cvar_t gCvarWatchdogTimeout;
+extern cvar_t gCvarWatchdogStrikes;
+extern cvar_t gCvarBreakerErrors;
+extern cvar_t gCvarBreakerWindow;
+extern cvar_t gCvarBreakerCooldown;
 
 // Server command function (SrvCommand.cpp)
 void SPModInfoCommand();
@@ -44,9 +44,9 @@ then
     mv build/libc++abi.so.1 libs
     mv build/libc++.so.1 libs
 
-    tar -cJvf $ARCHIVE_NAME dlls scripts libs
+    tar -cJvf $ARCHIVE_NAME dlls scripts configs libs
 else
-    tar -cJvf $ARCHIVE_NAME dlls scripts
+    tar -cJvf $ARCHIVE_NAME dlls scripts configs
 fi
 
 mkdir upload